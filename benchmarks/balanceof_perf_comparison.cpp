@@ -241,6 +241,11 @@ bool library_encode_balanceof_hex(char* out, size_t cap, const std::array<uint8_
     return true;
 }
 
+// Library encoding straight to "0x"-prefixed hex (no intermediate bytes)
+bool library_encode_call_hex(char* out, size_t cap, const std::array<uint8_t, 20>& address) {
+    return abi::protocols::ERC20_BalanceOf::template encode_call_hex<std::array<uint8_t, 20>>(out, cap, address);
+}
+
 // HFT-optimized library encoding wrapper (zero-allocation, bytes output)
 uint8_t* hft_library_encode_balanceof(const std::array<uint8_t, 20>& address) {
     return abi::protocols::ERC20_BalanceOf::encode_call_hft(address);
@@ -391,7 +396,7 @@ int main() {
 
     // Buffers for hex output
     std::vector<char> manual_hex_buffer(73);
-    std::vector<char> library_hex_buffer(73);
+    std::vector<char> library_hex_buffer(75);  // room for "0x" + 72 from encode_call_hex
     std::vector<char> libethc_hex_buffer(73);
     std::vector<char> hft_hex_buffer(73);
 
@@ -498,14 +503,17 @@ int main() {
     bool library_hex_success = library_encode_balanceof_hex(library_hex_buffer.data(), library_hex_buffer.size(), test_address);
     bool libethc_hex_success = libethc_encode_balanceof_hex(libethc_hex_buffer.data(), libethc_hex_buffer.size(), addr_hex);
     bool hft_hex_success = hft_encode_balanceof_hex(hft_hex_buffer.data(), hft_hex_buffer.size(), test_address);
+    bool call_hex_success = library_encode_call_hex(library_hex_buffer.data(), library_hex_buffer.size(), test_address) &&
+                            std::memcmp(library_hex_buffer.data() + 2, manual_hex_buffer.data(), 72) == 0;
 
     write_output("Hex encoding success rates:\n");
     write_output("  Manual: " + std::string(manual_hex_success ? "PASS" : "FAIL") + "\n");
     write_output("  Library: " + std::string(library_hex_success ? "PASS" : "FAIL") + "\n");
     write_output("  HFT Library: " + std::string(hft_hex_success ? "PASS" : "FAIL") + "\n");
+    write_output("  Library encode_call_hex: " + std::string(call_hex_success ? "PASS" : "FAIL") + "\n");
     write_output("  libethc: " + std::string(libethc_hex_success ? "PASS" : "FAIL") + "\n");
 
-    if (manual_hex_success && library_hex_success && hft_hex_success && libethc_hex_success) {
+    if (manual_hex_success && library_hex_success && call_hex_success && hft_hex_success && libethc_hex_success) {
         // Configure comprehensive benchmarking for hex
         BenchmarkConfig config;
         config.warmup_iterations = 1000;
@@ -527,6 +535,10 @@ int main() {
                 library_encode_balanceof_hex(library_hex_buffer.data(), library_hex_buffer.size(), test_address);
                 fold_hex_into_checksum(library_hex_buffer.data(), 72);
             }},
+            {"Library encode_call_hex", [&]() {
+                library_encode_call_hex(library_hex_buffer.data(), library_hex_buffer.size(), test_address);
+                fold_hex_into_checksum(library_hex_buffer.data() + 2, 72);
+            }},
             {"HFT Library (hex)", [&]() {
                 hft_encode_balanceof_hex(hft_hex_buffer.data(), hft_hex_buffer.size(), test_address);
                 fold_hex_into_checksum(hft_hex_buffer.data(), 72);
@@ -0,0 +1,88 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/abi/canonical.h"
+#include "../include/abi/protocols.h"
+
+// validate_canonical vs the obvious way to prove an encoding canonical
+// (decode, re-encode, compare bytes) on an aggregate3 response and a
+// PopulatedTick array.
+
+using namespace abi::protocols;
+using boost::multiprecision::cpp_int;
+
+template <class F>
+static double time_ns(int iterations, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterations;
+}
+
+static void report(const char* name, double roundtrip, double validate) {
+    std::cout << name << "\n";
+    std::cout << "  decode + re-encode: " << std::fixed << std::setprecision(1) << roundtrip << " ns\n";
+    std::cout << "  validate_canonical: " << std::fixed << std::setprecision(1) << validate << " ns"
+              << "  (" << std::setprecision(2) << (roundtrip / validate) << "x)\n";
+}
+
+// Canonical iff re-encoding the decoded value reproduces the input
+template <class Schema>
+static bool roundtrip_canonical(abi::BytesSpan in, typename abi::value_of<Schema>::type& v,
+                                std::vector<uint8_t>& scratch) {
+    if (!abi::decode_from<Schema>(in, v)) return false;
+    scratch.resize(abi::encoded_size<Schema>(v));
+    abi::encode_into<Schema>(scratch.data(), scratch.size(), v);
+    return scratch.size() == in.size() && std::memcmp(scratch.data(), in.data(), in.size()) == 0;
+}
+
+int main() {
+    std::cout << "=== Canonical check: decode + re-encode vs validate_canonical ===\n\n";
+    bool ok = true;
+    std::vector<uint8_t> scratch;
+
+    // --- aggregate3 response: 64 results of 32..96 bytes ---
+    std::vector<Multicall3_Result> results(64);
+    for (size_t i = 0; i < results.size(); ++i) {
+        results[i].success = i % 5 != 0;
+        results[i].returnData.assign(32 + 32 * (i % 3), static_cast<uint8_t>(i));
+    }
+    using Results = abi::dyn_array<Multicall3_Result>;
+    std::vector<uint8_t> resp(abi::encoded_size<Results>(results));
+    abi::encode_into<Results>(resp.data(), resp.size(), results);
+    const abi::BytesSpan rin(resp.data(), resp.size());
+    abi::value_of<Results>::type rv;
+    const int result_iterations = 20000;
+    bool a = false, b = false;
+    double r1 = time_ns(result_iterations, [&] { a = roundtrip_canonical<Results>(rin, rv, scratch); });
+    double v1 = time_ns(result_iterations, [&] { b = abi::validate_canonical<Results>(rin); });
+    ok = ok && a && b;
+    report("aggregate3 results (64 entries):", r1, v1);
+
+    // --- 256 populated ticks ---
+    std::vector<ITickLens_PopulatedTick> ticks(256);
+    for (int i = 0; i < 256; ++i) {
+        ticks[i].tick = i * 60 - 7680;
+        ticks[i].liquidityNet = (i % 2 ? -1 : 1) * (cpp_int(1) << 80) / (i + 1);
+        ticks[i].liquidityGross = (cpp_int(1) << 80) / (i + 1);
+    }
+    using Ticks = abi::dyn_array<ITickLens_PopulatedTick>;
+    std::vector<uint8_t> tb(abi::encoded_size<Ticks>(ticks));
+    abi::encode_into<Ticks>(tb.data(), tb.size(), ticks);
+    const abi::BytesSpan tin(tb.data(), tb.size());
+    abi::value_of<Ticks>::type tv;
+    const int tick_iterations = 2000;
+    double r2 = time_ns(tick_iterations, [&] { a = roundtrip_canonical<Ticks>(tin, tv, scratch); });
+    double v2 = time_ns(tick_iterations, [&] { b = abi::validate_canonical<Ticks>(tin); });
+    ok = ok && a && b;
+    report("PopulatedTick[256]:", r2, v2);
+
+    // Both must reject the same dirty word
+    tb[32 + 32 + 1] = 1;  // high byte of ticks[0].tick (int24)
+    ok = ok && !roundtrip_canonical<Ticks>(tin, tv, scratch) && !abi::validate_canonical<Ticks>(tin);
+
+    std::cout << "\nOutputs identical: " << (ok ? "YES" : "NO") << "\n";
+    return ok ? 0 : 1;
+}
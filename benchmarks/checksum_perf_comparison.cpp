@@ -0,0 +1,66 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../include/abi/hex.h"
+
+// EIP-55 over 10,000 addresses: one keccak per address vs the batch forms
+// that hash four (AVX2) or two (SSE2) addresses per permutation.
+
+template <class F>
+static double time_ns(int iterations, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterations;
+}
+
+static void report(const char* name, double single, double batch, size_t n) {
+    std::cout << name << "\n" << std::fixed;
+    std::cout << "  per address: " << std::setprecision(1) << single / n << " ns\n";
+    std::cout << "  batch:       " << std::setprecision(1) << batch / n << " ns"
+              << "  (" << std::setprecision(2) << (single / batch) << "x)\n";
+}
+
+int main() {
+    const size_t n = 10000;
+    std::vector<std::array<uint8_t, 20>> addrs(n);
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < 20; ++j) addrs[i][j] = static_cast<uint8_t>(i * 2654435761u >> (j % 24));
+
+    std::cout << "=== EIP-55 checksums (" << n << " addresses) ===\n";
+#if defined(__AVX2__)
+    std::cout << "Keccak lanes: 4 (AVX2)\n\n";
+#elif defined(__SSE2__)
+    std::cout << "Keccak lanes: 2 (SSE2)\n\n";
+#else
+    std::cout << "Keccak lanes: 1\n\n";
+#endif
+
+    const int iterations = 10;
+    std::string a(42 * n, '?'), b(42 * n, '?');
+    double t_single = time_ns(iterations, [&] {
+        for (size_t i = 0; i < n; ++i) abi::addr_to_checksum_hex(addrs[i].data(), a.data() + 42 * i);
+    });
+    double t_batch = time_ns(iterations, [&] { abi::addr_to_checksum_hex(addrs.data(), n, b.data()); });
+    bool ok = a == b;
+    report("Format:", t_single, t_batch, n);
+
+    std::vector<std::string_view> views(n);
+    for (size_t i = 0; i < n; ++i) views[i] = std::string_view(a).substr(42 * i, 42);
+    std::unique_ptr<bool[]> valid(new bool[n]);
+    size_t count_single = 0, count_batch = 0;
+    double v_single = time_ns(iterations, [&] {
+        count_single = 0;
+        for (size_t i = 0; i < n; ++i) count_single += abi::addr_validate_checksum(views[i]);
+    });
+    double v_batch = time_ns(iterations, [&] { count_batch = abi::addr_validate_checksum(views.data(), n, valid.get()); });
+    ok = ok && count_single == n && count_batch == n;
+    report("Validate:", v_single, v_batch, n);
+
+    std::cout << "\nOutputs identical: " << (ok ? "YES" : "NO") << "\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../include/abi/u256.h"
+
+// Decimal amounts (18-decimal token values up to full 256-bit words):
+// cpp_int::str() / cpp_int(const char*) vs u256_to_decimal /
+// u256_from_decimal into caller buffers.
+
+using boost::multiprecision::cpp_int;
+
+template <class F>
+static double time_ns(int iterations, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterations;
+}
+
+static void report(const char* name, double boost_ns, double native_ns) {
+    std::cout << name << "\n" << std::fixed;
+    std::cout << "  cpp_int: " << std::setprecision(1) << boost_ns << " ns\n";
+    std::cout << "  u256:    " << std::setprecision(1) << native_ns << " ns"
+              << "  (" << std::setprecision(2) << (boost_ns / native_ns) << "x)\n";
+}
+
+int main() {
+    std::cout << "=== Decimal formatting and parsing ===\n\n";
+    struct Case {
+        const char* name;
+        cpp_int value;
+    };
+    const std::vector<Case> cases{
+        {"1.5 ETH in wei (19 digits):", cpp_int("1500000000000000000")},
+        {"Pool reserve (30 digits):", cpp_int("123456789012345678901234567890")},
+        {"uint256 max (78 digits):", (cpp_int(1) << 256) - 1},
+    };
+    const int iterations = 100000;
+    bool ok = true;
+    for (const auto& c : cases) {
+        abi::u256 v;
+        abi::u256_from_cpp_int(c.value, v);
+        const std::string text = c.value.str();
+        char buf[abi::u256_max_decimal];
+        size_t n = 0;
+        std::string s;
+        double f_boost = time_ns(iterations, [&] { s = c.value.str(); });
+        double f_native = time_ns(iterations, [&] { n = abi::u256_to_decimal(buf, v); });
+        ok = ok && std::string(buf, n) == s;
+
+        cpp_int parsed;
+        abi::u256 back;
+        double p_boost = time_ns(iterations, [&] { parsed = cpp_int(text.c_str()); });
+        double p_native = time_ns(iterations, [&] { abi::u256_from_decimal(text, back); });
+        ok = ok && parsed == c.value && back == v;
+
+        std::cout << c.name << "\n";
+        report(" format", f_boost, f_native);
+        report(" parse", p_boost, p_native);
+    }
+    std::cout << "\nOutputs identical: " << (ok ? "YES" : "NO") << "\n";
+    return ok ? 0 : 1;
+}
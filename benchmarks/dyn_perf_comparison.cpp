@@ -0,0 +1,91 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../include/abi/dyn.h"
+#include "../include/abi/protocols.h"
+
+// Runtime-loaded ABI (compiled dyn::Plan) vs template traits<> on the same
+// payloads: TickLens result decode and aggregate3 call encode.
+
+using namespace abi::protocols;
+using boost::multiprecision::cpp_int;
+
+template <class F>
+static double time_ns(int iterations, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterations;
+}
+
+static void report(const char* name, double tmpl, double dyn) {
+    std::cout << name << "\n";
+    std::cout << "  traits<>:  " << std::fixed << std::setprecision(1) << tmpl << " ns\n";
+    std::cout << "  dyn::Plan: " << std::fixed << std::setprecision(1) << dyn << " ns"
+              << "  (" << std::setprecision(2) << (dyn / tmpl) << "x)\n";
+}
+
+int main() {
+    abi::dyn::Abi ticklens, multicall;
+    abi::Error err;
+    const std::string dir = ABI_JSON_DIR;
+    if (!abi::dyn::Abi::load_file(dir + "/uniswap_v3_tick_lens.json", ticklens, &err) ||
+        !abi::dyn::Abi::load_file(dir + "/multicall.json", multicall, &err)) {
+        std::cerr << "ABI load failed: " << err.message << "\n";
+        return 1;
+    }
+    const auto* ticks_fn = ticklens.function("getPopulatedTicksInWord");
+    const auto* agg_fn = multicall.function("aggregate3");
+
+    std::cout << "=== Runtime ABI (dyn::Plan) vs traits<> ===\n";
+    std::cout << "Plan sizes: getPopulatedTicksInWord outputs " << ticks_fn->output_plan->instructions()
+              << " insns, aggregate3 inputs " << agg_fn->input_plan->instructions() << " insns\n\n";
+
+    // --- decode: 64 populated ticks ---
+    std::vector<ITickLens_PopulatedTick> ticks(64);
+    for (int i = 0; i < 64; ++i) {
+        ticks[i].tick = i * 60 - 1920;
+        ticks[i].liquidityNet = (i % 2 ? -1 : 1) * (cpp_int(1) << 80) / (i + 1);
+        ticks[i].liquidityGross = (cpp_int(1) << 80) / (i + 1);
+    }
+    using TickArray = abi::dyn_array<ITickLens_PopulatedTick>;
+    std::vector<uint8_t> resp(abi::encoded_size<TickArray>(ticks));
+    abi::encode_into<TickArray>(resp.data(), resp.size(), ticks);
+    abi::BytesSpan in(resp.data(), resp.size());
+
+    const int decode_iterations = 2000;
+    std::vector<ITickLens_PopulatedTick> tmpl_out;
+    abi::dyn::Value::List dyn_out;
+    bool ok = UniswapV3TickLens_GetPopulatedTicksInWord::decode_result(in, tmpl_out) &&
+              ticks_fn->decode_result(in, dyn_out) && dyn_out[0].as_list().size() == 64;
+    double t_tmpl = time_ns(decode_iterations, [&] {
+        UniswapV3TickLens_GetPopulatedTicksInWord::decode_result(in, tmpl_out);
+    });
+    double t_dyn = time_ns(decode_iterations, [&] { ticks_fn->decode_result(in, dyn_out); });
+    report("Decode getPopulatedTicksInWord (64 ticks):", t_tmpl, t_dyn);
+
+    // --- encode: aggregate3 with 32 balanceOf calls ---
+    std::vector<Multicall3_Call3> calls(32);
+    abi::dyn::Value::List list;
+    for (size_t i = 0; i < calls.size(); ++i) {
+        calls[i].target.fill(static_cast<uint8_t>(i));
+        calls[i].allowFailure = true;
+        calls[i].callData.assign(36, static_cast<uint8_t>(i));
+        list.push_back(abi::dyn::Value::List{calls[i].target, true, calls[i].callData});
+    }
+    abi::dyn::Value::List args{abi::dyn::Value(list)};
+    std::vector<uint8_t> a(Multicall_Aggregate3::encoded_size(calls)), b(agg_fn->encoded_size(args));
+    const int encode_iterations = 20000;
+    double e_tmpl = time_ns(encode_iterations, [&] {
+        Multicall_Aggregate3::encode_call<std::vector<Multicall3_Call3>>(a.data(), a.size(), calls);
+    });
+    double e_dyn = time_ns(encode_iterations, [&] { agg_fn->encode_call(b.data(), b.size(), args); });
+    ok = ok && a == b;
+    report("Encode aggregate3 (32 calls):", e_tmpl, e_dyn);
+
+    std::cout << "\nOutputs identical: " << (ok ? "YES" : "NO") << "\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../include/abi/hex.h"
+
+// Hex text <-> bytes for an address (20 B), a word (32 B) and a 4 KiB
+// payload: the previous per-character std::string / std::vector builders vs
+// hex_encode / hex_decode into caller buffers.
+
+template <class F>
+static double time_ns(int iterations, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterations;
+}
+
+// Pre-kernel bytes_to_hex_string
+static std::string legacy_to_hex(const std::vector<uint8_t>& bytes) {
+    std::string result;
+    result.reserve(2 + bytes.size() * 2);
+    result = "0x";
+    for (uint8_t byte : bytes) {
+        result.push_back(abi::hex_chars[byte >> 4]);
+        result.push_back(abi::hex_chars[byte & 0x0F]);
+    }
+    return result;
+}
+
+// Pre-kernel parse_hex
+static std::vector<uint8_t> legacy_parse_hex(const std::string& h) {
+    auto val = [](char c) -> uint8_t {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return 0;
+    };
+    std::vector<uint8_t> out;
+    size_t i = (h.size() >= 2 && h[0] == '0' && (h[1] == 'x' || h[1] == 'X')) ? 2 : 0;
+    out.reserve((h.size() - i + 1) / 2);
+    for (; i + 1 < h.size(); i += 2) out.push_back(static_cast<uint8_t>((val(h[i]) << 4) | val(h[i + 1])));
+    return out;
+}
+
+static volatile size_t sink;
+
+static bool run(size_t n, int iterations) {
+    std::vector<uint8_t> data(n);
+    for (size_t i = 0; i < n; ++i) data[i] = static_cast<uint8_t>(i * 131 + 7);
+    const std::string text = legacy_to_hex(data);
+    std::vector<char> chars(2 + 2 * n);
+    std::vector<uint8_t> bytes(n);
+
+    double enc_old = time_ns(iterations, [&] { sink = legacy_to_hex(data).size(); });
+    double enc_new = time_ns(iterations, [&] {
+        sink = abi::bytes_to_hex_string(abi::BytesSpan(data.data(), n), chars.data(), chars.size());
+    });
+    double dec_old = time_ns(iterations, [&] { sink = legacy_parse_hex(text).size(); });
+    double dec_new = time_ns(iterations, [&] {
+        size_t len = 0;
+        sink = abi::parse_hex(text, bytes.data(), bytes.size(), len) ? len : 0;
+    });
+
+    const bool ok = std::string(chars.data(), chars.size()) == text && bytes == data &&
+                    legacy_parse_hex(text) == data;
+    std::cout << n << " bytes\n" << std::fixed;
+    std::cout << "  encode  legacy: " << std::setprecision(1) << enc_old << " ns   buffer: " << enc_new
+              << " ns  (" << std::setprecision(2) << enc_old / enc_new << "x, " << n / enc_new << " GB/s)\n";
+    std::cout << "  decode  legacy: " << std::setprecision(1) << dec_old << " ns   buffer: " << dec_new
+              << " ns  (" << std::setprecision(2) << dec_old / dec_new << "x, " << n / dec_new << " GB/s)\n";
+    return ok;
+}
+
+int main() {
+    std::cout << "=== Hex encode/decode ===\n";
+#if defined(__AVX2__)
+    std::cout << "Kernels: AVX2\n\n";
+#elif defined(__SSSE3__)
+    std::cout << "Kernels: SSSE3\n\n";
+#elif defined(__SSE2__)
+    std::cout << "Kernels: SSE2\n\n";
+#else
+    std::cout << "Kernels: scalar\n\n";
+#endif
+    bool ok = run(20, 200000) && run(32, 200000) && run(4096, 5000);
+    std::cout << "\nOutputs identical: " << (ok ? "YES" : "NO") << "\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../include/abi/json.h"
+#include "../include/abi/protocols.h"
+
+// JSON for a decoded getPopulatedTicksInWord result: string building with
+// cpp_int::str() (one std::string per field) vs abi::to_json into a caller
+// buffer vs abi::to_json_view straight from the encoded payload.
+
+using namespace abi::protocols;
+using boost::multiprecision::cpp_int;
+
+template <class F>
+static double time_ns(int iterations, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterations;
+}
+
+static std::string naive_json(const std::vector<ITickLens_PopulatedTick>& ticks) {
+    std::string out = "[";
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        if (i) out += ",";
+        out += "{\"tick\":\"" + ticks[i].tick.str() + "\",\"liquidityNet\":\"" + ticks[i].liquidityNet.str() +
+               "\",\"liquidityGross\":\"" + ticks[i].liquidityGross.str() + "\"}";
+    }
+    return out + "]";
+}
+
+int main() {
+    std::vector<ITickLens_PopulatedTick> ticks(64);
+    for (int i = 0; i < 64; ++i) {
+        ticks[i].tick = i * 60 - 1920;
+        ticks[i].liquidityNet = (i % 2 ? -1 : 1) * (cpp_int(1) << 100) / (i + 1);
+        ticks[i].liquidityGross = (cpp_int(1) << 100) / (i + 1);
+    }
+    using TickArray = abi::dyn_array<ITickLens_PopulatedTick>;
+    std::vector<uint8_t> enc(abi::encoded_size<TickArray>(ticks));
+    abi::encode_into<TickArray>(enc.data(), enc.size(), ticks);
+    const abi::BytesSpan in(enc.data(), enc.size());
+
+    std::vector<char> buf(64 * 1024);
+    const int iterations = 2000;
+    std::string naive;
+    size_t n_json = 0, n_view = 0;
+    double t_naive = time_ns(iterations, [&] { naive = naive_json(ticks); });
+    double t_json = time_ns(iterations, [&] {
+        abi::BufferSink sink(buf.data(), buf.size());
+        abi::to_json<TickArray>(ticks, sink);
+        n_json = sink.size();
+    });
+    const std::string from_values(buf.data(), n_json);
+    double t_view = time_ns(iterations, [&] {
+        abi::BufferSink sink(buf.data(), buf.size());
+        abi::to_json_view<TickArray>(in, sink);
+        n_view = sink.size();
+    });
+    const std::string from_view(buf.data(), n_view);
+
+    std::cout << "=== JSON for 64 populated ticks (" << n_json << " bytes) ===\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  cpp_int::str() + std::string: " << t_naive << " ns\n";
+    std::cout << "  abi::to_json (BufferSink):    " << t_json << " ns  (" << std::setprecision(2)
+              << t_naive / t_json << "x)\n";
+    std::cout << std::setprecision(1) << "  abi::to_json_view (encoded):  " << t_view << " ns  ("
+              << std::setprecision(2) << t_naive / t_view << "x)\n";
+
+    const bool ok = naive == from_values && naive == from_view;
+    std::cout << "\nOutputs identical: " << (ok ? "YES" : "NO") << "\n";
+    return ok ? 0 : 1;
+}
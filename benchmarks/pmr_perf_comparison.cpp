@@ -0,0 +1,76 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+
+#include "../include/abi/abi.h"
+#include "../include/abi/protocols.h"
+
+// One block's worth of aggregate3 responses (32 responses of 64 results)
+// decoded through the generated Multicall_Aggregate3::decode_result into
+// return_t (std containers) vs pmr_return_t (std::pmr containers and
+// protocols::pmr::Multicall3_Result) backed by a monotonic arena that is
+// released once per block.
+
+using Agg = abi::protocols::Multicall_Aggregate3;
+using Results = Agg::return_schema;
+
+template <class F>
+static double time_ns(int iterations, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterations;
+}
+
+static void report(const char* name, double heap, double arena) {
+    std::cout << name << "\n";
+    std::cout << "  std containers: " << std::fixed << std::setprecision(1) << heap << " ns\n";
+    std::cout << "  pmr arena:      " << std::fixed << std::setprecision(1) << arena << " ns"
+              << "  (" << std::setprecision(2) << (heap / arena) << "x)\n";
+}
+
+int main() {
+    std::cout << "=== Block decode: global heap vs pmr arena ===\n\n";
+
+    Agg::return_t results(64);
+    for (size_t i = 0; i < results.size(); ++i) {
+        results[i].success = i % 5 != 0;
+        results[i].returnData.assign(32 + 32 * (i % 3), static_cast<uint8_t>(i));
+    }
+    std::vector<uint8_t> resp(abi::encoded_size<Results>(results));
+    abi::encode_into<Results>(resp.data(), resp.size(), results);
+    const abi::BytesSpan in(resp.data(), resp.size());
+    const size_t responses = 32;
+
+    size_t heap_bytes = 0, arena_bytes = 0;
+    const int iterations = 500;
+    double t_heap = time_ns(iterations, [&] {
+        std::vector<Agg::return_t> block(responses);
+        for (auto& out : block) Agg::decode_result(in, out);
+        heap_bytes = block.back().back().returnData.size();
+    });
+
+    std::pmr::monotonic_buffer_resource arena(1 << 20);
+    double t_arena = time_ns(iterations, [&] {
+        {
+            std::pmr::vector<Agg::pmr_return_t> block(responses, &arena);
+            for (auto& out : block) Agg::decode_result(in, out);
+            arena_bytes = block.back().back().returnData.size();
+        }
+        arena.release();  // whole block at once
+    });
+    report("Decode 32 x aggregate3 results (64 entries each):", t_heap, t_arena);
+
+    std::pmr::vector<Agg::pmr_return_t> check(1, &arena);
+    bool ok = heap_bytes == arena_bytes && Agg::decode_result(in, check[0]) && check[0].size() == results.size();
+    for (size_t i = 0; ok && i < results.size(); ++i) {
+        const auto& got = check[0][i].returnData;
+        ok = check[0][i].success == results[i].success && got.get_allocator().resource() == &arena &&
+             std::equal(got.begin(), got.end(), results[i].returnData.begin(), results[i].returnData.end());
+    }
+
+    std::cout << "\nOutputs identical: " << (ok ? "YES" : "NO") << "\n";
+    return ok ? 0 : 1;
+}
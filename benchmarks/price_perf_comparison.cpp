@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/abi/uniswap_v3.h"
+
+// sqrtPriceX96 -> price for 10,000 pools: cpp_int::convert_to<double>() per
+// value vs the native u256 column kernel.
+
+using boost::multiprecision::cpp_int;
+
+template <class F>
+static double time_ns(int iterations, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterations;
+}
+
+int main() {
+    const size_t n = 10000;
+    std::vector<cpp_int> sqrtp(n);
+    std::vector<abi::uniswap_v3::Slot0> states(n);
+    for (size_t i = 0; i < n; ++i) {
+        // Spread over ~2^64 .. 2^159
+        sqrtp[i] = (cpp_int(1) << (64 + i % 95)) + cpp_int(i) * 0x9e3779b97f4a7c15ULL;
+        abi::u256_from_cpp_int(sqrtp[i], states[i].sqrtPriceX96);
+    }
+
+    std::cout << "=== sqrtPriceX96 -> price (" << n << " pools) ===\n\n";
+    const int iterations = 20;
+    std::vector<double> a(n), b(n);
+    const double q192 = std::ldexp(1.0, 192);
+    double t_boost = time_ns(iterations, [&] {
+        for (size_t i = 0; i < n; ++i) {
+            const double s = sqrtp[i].convert_to<double>();
+            a[i] = s * s / q192;
+        }
+    });
+    double t_native = time_ns(iterations, [&] { abi::uniswap_v3::sqrt_price_x96_to_price(states, b.data()); });
+
+    double worst = 0;
+    for (size_t i = 0; i < n; ++i) worst = std::max(worst, std::abs(a[i] - b[i]) / a[i]);
+    std::cout << "cpp_int convert_to<double>: " << std::fixed << std::setprecision(1) << t_boost / n
+              << " ns/pool\n";
+    std::cout << "u256 column kernel:         " << t_native / n << " ns/pool  (" << std::setprecision(2)
+              << t_boost / t_native << "x)\n";
+    std::cout << "Max relative difference: " << std::scientific << std::setprecision(2) << worst << "\n";
+    const bool ok = worst < 1e-15;
+    std::cout << "\nOutputs agree: " << (ok ? "YES" : "NO") << "\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/abi/protocols.h"
+
+// Polling pattern: decode each block's response into a fresh result vs
+// into the previous block's result, whose vectors, strings and integer
+// limbs are overwritten in place.
+
+using namespace abi::protocols;
+using boost::multiprecision::cpp_int;
+
+template <class F>
+static double time_ns(int iterations, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterations;
+}
+
+static void report(const char* name, double fresh, double reused) {
+    std::cout << name << "\n";
+    std::cout << "  fresh output:  " << std::fixed << std::setprecision(1) << fresh << " ns\n";
+    std::cout << "  reused output: " << std::fixed << std::setprecision(1) << reused << " ns"
+              << "  (" << std::setprecision(2) << (fresh / reused) << "x)\n";
+}
+
+int main() {
+    std::cout << "=== Repeated decode: fresh vs reused output ===\n\n";
+    bool ok = true;
+
+    // --- aggregate3 response: 64 results of 32..96 bytes ---
+    std::vector<Multicall3_Result> results(64);
+    for (size_t i = 0; i < results.size(); ++i) {
+        results[i].success = i % 5 != 0;
+        results[i].returnData.assign(32 + 32 * (i % 3), static_cast<uint8_t>(i));
+    }
+    using Results = abi::dyn_array<Multicall3_Result>;
+    std::vector<uint8_t> resp(abi::encoded_size<Results>(results));
+    abi::encode_into<Results>(resp.data(), resp.size(), results);
+    const abi::BytesSpan rin(resp.data(), resp.size());
+    Multicall_Aggregate3::return_t r1, r2;
+    const int result_iterations = 20000;
+    double f1 = time_ns(result_iterations, [&] {
+        Multicall_Aggregate3::return_t out;
+        Multicall_Aggregate3::decode_result(rin, out);
+        r1.swap(out);
+    });
+    double u1 = time_ns(result_iterations, [&] { Multicall_Aggregate3::decode_result(rin, r2); });
+    for (size_t i = 0; i < results.size(); ++i)
+        ok = ok && r1[i].returnData == r2[i].returnData && r2[i].returnData == results[i].returnData;
+    report("Decode aggregate3 results (64 entries):", f1, u1);
+
+    // --- 256 populated ticks (int24, int128, uint128) ---
+    std::vector<ITickLens_PopulatedTick> ticks(256);
+    for (int i = 0; i < 256; ++i) {
+        ticks[i].tick = i * 60 - 7680;
+        ticks[i].liquidityNet = (i % 2 ? -1 : 1) * (cpp_int(1) << 60) / (i + 1);
+        ticks[i].liquidityGross = (cpp_int(1) << 120) / (i + 1);
+    }
+    using Ticks = abi::dyn_array<ITickLens_PopulatedTick>;
+    std::vector<uint8_t> tb(abi::encoded_size<Ticks>(ticks));
+    abi::encode_into<Ticks>(tb.data(), tb.size(), ticks);
+    const abi::BytesSpan tin(tb.data(), tb.size());
+    std::vector<ITickLens_PopulatedTick> t1, t2;
+    const int tick_iterations = 2000;
+    double f2 = time_ns(tick_iterations, [&] {
+        std::vector<ITickLens_PopulatedTick> out;
+        abi::decode_from<Ticks>(tin, out);
+        t1.swap(out);
+    });
+    double u2 = time_ns(tick_iterations, [&] { abi::decode_from<Ticks>(tin, t2); });
+    for (int i = 0; i < 256; ++i)
+        ok = ok && t1[i].liquidityNet == t2[i].liquidityNet && t2[i].liquidityNet == ticks[i].liquidityNet &&
+             t2[i].liquidityGross == ticks[i].liquidityGross && t2[i].tick == ticks[i].tick;
+    report("Decode PopulatedTick[256]:", f2, u2);
+
+    std::cout << "\nOutputs identical: " << (ok ? "YES" : "NO") << "\n";
+    return ok ? 0 : 1;
+}
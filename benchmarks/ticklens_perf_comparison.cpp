@@ -10,6 +10,7 @@
 #include <sstream>
 #include <algorithm>
 #include "../include/abi/protocols.h"
+#include "../include/abi/uniswap_v3.h"
 
 // libethc C API - minimal declarations to avoid GMP conflicts
 extern "C" {
@@ -79,9 +80,7 @@ bool library_encode_ticklens_getpopulatedticks(uint8_t* out, size_t cap,
     // Debug: print error information if encoding failed
     if (!result) {
         std::cerr << "TickLens encoding failed! Error details:" << std::endl;
-        std::cerr << "Error message: " << err.message << std::endl;
-        std::cerr << "Error path: " << err.path << std::endl;
-        std::cerr << "Error offset: " << err.offset << std::endl;
+        std::cerr << "Error: " << err.to_string() << std::endl;
     }
 
     return result;
@@ -218,9 +217,7 @@ bool test_ticklens_decoding(const std::vector<uint8_t>& response_data) {
 
     if (!success) {
         std::cerr << "TickLens decoding failed! Error details:" << std::endl;
-        std::cerr << "Error message: " << err.message << std::endl;
-        std::cerr << "Error path: " << err.path << std::endl;
-        std::cerr << "Error offset: " << err.offset << std::endl;
+        std::cerr << "Error: " << err.to_string() << std::endl;
         return false;
     }
 
@@ -434,6 +431,48 @@ int main() {
                 }
             }
 
+            // Decode benchmark: a fully populated 256-tick word
+            {
+                using abi::protocols::ITickLens_PopulatedTick;
+                using TickArray = abi::dyn_array<ITickLens_PopulatedTick>;
+                std::vector<ITickLens_PopulatedTick> ticks(256);
+                for (int i = 0; i < 256; ++i) {
+                    ticks[i].tick = i * 60 - 7680;
+                    ticks[i].liquidityNet = (i % 2 ? -1 : 1) * (boost::multiprecision::cpp_int(1) << 90) / (i + 1);
+                    ticks[i].liquidityGross = (boost::multiprecision::cpp_int(1) << 90) / (i + 1);
+                }
+                std::vector<uint8_t> resp(abi::encoded_size<TickArray>(ticks));
+                abi::encode_into<TickArray>(resp.data(), resp.size(), ticks);
+                abi::BytesSpan in(resp.data(), resp.size());
+
+                const int decode_iterations = 1000;
+                std::vector<ITickLens_PopulatedTick> decoded;
+                start = std::chrono::high_resolution_clock::now();
+                for (int i = 0; i < decode_iterations; ++i) {
+                    abi::protocols::UniswapV3TickLens_GetPopulatedTicksInWord::decode_result(in, decoded);
+                }
+                end = std::chrono::high_resolution_clock::now();
+                double generic_ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / decode_iterations;
+
+                abi::uniswap_v3::TickColumns cols;
+                bool columnar_ok = true;
+                start = std::chrono::high_resolution_clock::now();
+                for (int i = 0; i < decode_iterations; ++i) {
+                    cols.clear();
+                    columnar_ok &= abi::uniswap_v3::decode_populated_ticks(in, cols);
+                }
+                end = std::chrono::high_resolution_clock::now();
+                double columnar_ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / decode_iterations;
+
+                std::cout << "\n=== DECODE (256 populated ticks) ===" << std::endl;
+                std::cout << "Generic decode_result (cpp_int structs): " << std::fixed << std::setprecision(1) << generic_ns << " ns\n";
+                std::cout << "Columnar int32/int128 decode:            " << std::fixed << std::setprecision(1) << columnar_ns << " ns"
+                          << (columnar_ok && cols.size() == 256 ? "" : " (FAILED)") << "\n";
+                if (columnar_ns > 0) {
+                    std::cout << "Columnar speedup: " << std::fixed << std::setprecision(1) << (generic_ns / columnar_ns) << "x\n";
+                }
+            }
+
             std::cout << "\n=== ANALYSIS ===" << std::endl;
             std::cout << "TickLens getPopulatedTicksInWord benchmark:\n";
             std::cout << "- Function: getPopulatedTicksInWord(address, int16)\n";
@@ -0,0 +1,90 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/abi/protocols.h"
+
+// Checked vs trusted decode policy on the same payloads: an aggregate3
+// response (dyn_array<(bool,bytes)>), a swapExactTokensForTokens call and an
+// array of static (address, bool, uint8) tuples.
+
+using namespace abi::protocols;
+using boost::multiprecision::cpp_int;
+
+template <class F>
+static double time_ns(int iterations, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterations;
+}
+
+static void report(const char* name, double checked, double trusted) {
+    std::cout << name << "\n";
+    std::cout << "  checked: " << std::fixed << std::setprecision(1) << checked << " ns\n";
+    std::cout << "  trusted: " << std::fixed << std::setprecision(1) << trusted << " ns"
+              << "  (" << std::setprecision(2) << (checked / trusted) << "x)\n";
+}
+
+int main() {
+    std::cout << "=== Decode policy: checked vs trusted ===\n\n";
+    bool ok = true;
+
+    // --- aggregate3 response: 64 results of 32..96 bytes ---
+    std::vector<Multicall3_Result> results(64);
+    for (size_t i = 0; i < results.size(); ++i) {
+        results[i].success = i % 5 != 0;
+        results[i].returnData.assign(32 + 32 * (i % 3), static_cast<uint8_t>(i));
+    }
+    using Results = abi::dyn_array<Multicall3_Result>;
+    std::vector<uint8_t> resp(abi::encoded_size<Results>(results));
+    abi::encode_into<Results>(resp.data(), resp.size(), results);
+    const abi::BytesSpan rin(resp.data(), resp.size());
+    Multicall_Aggregate3::return_t r1, r2;
+    const int result_iterations = 20000;
+    double c1 = time_ns(result_iterations, [&] { Multicall_Aggregate3::decode_result(rin, r1); });
+    double t1 = time_ns(result_iterations, [&] { Multicall_Aggregate3::decode_result<abi::trusted>(rin, r2); });
+    for (size_t i = 0; i < results.size(); ++i)
+        ok = ok && r1[i].returnData == r2[i].returnData && r1[i].success == r2[i].success;
+    report("Decode aggregate3 results (64 entries):", c1, t1);
+
+    // --- calldata: swapExactTokensForTokens with a 4-hop path ---
+    using Swap = UniswapV2Router_SwapExactTokensForTokens;
+    std::vector<std::array<uint8_t, 20>> path(4);
+    for (size_t i = 0; i < path.size(); ++i) path[i].fill(static_cast<uint8_t>(0xa0 + i));
+    std::array<uint8_t, 20> to{};
+    const cpp_int amount = cpp_int("1000000000000000000"), deadline = 1700000000;
+    std::vector<uint8_t> cd(Swap::encoded_size(amount, amount, path, to, deadline));
+    Swap::encode_call<cpp_int, cpp_int, std::vector<std::array<uint8_t, 20>>, std::array<uint8_t, 20>,
+                      cpp_int>(cd.data(), cd.size(), amount, amount, path, to, deadline);
+    const abi::BytesSpan cin(cd.data(), cd.size());
+    Swap::args_t a1, a2;
+    const int call_iterations = 200000;
+    double c2 = time_ns(call_iterations, [&] { Swap::decode_call(cin, a1); });
+    double t2 = time_ns(call_iterations, [&] { Swap::decode_call<abi::trusted>(cin, a2); });
+    ok = ok && a1 == a2;
+    report("Decode swapExactTokensForTokens calldata:", c2, t2);
+
+    // --- 256 static (address, bool, uint8) tuples ---
+    using Row = abi::tuple<abi::address20, abi::bool_t, abi::uint_t<8>>;
+    using Rows = abi::dyn_array<Row>;
+    std::vector<std::tuple<std::array<uint8_t, 20>, bool, cpp_int>> rows(256);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        std::get<0>(rows[i]).fill(static_cast<uint8_t>(i));
+        std::get<1>(rows[i]) = i & 1;
+        std::get<2>(rows[i]) = i & 0xff;
+    }
+    std::vector<uint8_t> rb(abi::encoded_size<Rows>(rows));
+    abi::encode_into<Rows>(rb.data(), rb.size(), rows);
+    const abi::BytesSpan rowin(rb.data(), rb.size());
+    abi::value_of<Rows>::type o1, o2;
+    const int row_iterations = 5000;
+    double c3 = time_ns(row_iterations, [&] { abi::decode_from<Rows>(rowin, o1); });
+    double t3 = time_ns(row_iterations, [&] { abi::decode_from<Rows, abi::trusted>(rowin, o2); });
+    ok = ok && o1 == o2 && o1 == rows;
+    report("Decode (address,bool,uint8)[256]:", c3, t3);
+
+    std::cout << "\nOutputs identical: " << (ok ? "YES" : "NO") << "\n";
+    return ok ? 0 : 1;
+}
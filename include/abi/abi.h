@@ -5,6 +5,9 @@
 #include <cassert>
 #include <cstdint>
 #include <cstring>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -12,6 +15,10 @@
 #include <utility>
 #include <vector>
 
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace abi {
 
 // ----------------- minimal Span<T> for C++17 -----------------
@@ -66,15 +73,452 @@ thread_local HFTBuffer<4096> hft_buffer;
 using BytesSpan = Span<const uint8_t>;
 
 // ----------------- error -----------------
+// Failure category; stable across releases, so callers can branch on it
+// instead of comparing message text.
+enum class ErrorCode : uint8_t {
+    none,
+    short_input,        // a length, head or tail runs past the input
+    bad_offset,         // offset word out of bounds or out of order
+    out_of_range,       // value or length does not fit the target type
+    buffer_too_small,   // caller's output buffer cannot hold the result
+    selector_mismatch,  // wrong or unknown function selector
+    invalid_text,       // hex, decimal or JSON text is malformed
+    limit_exceeded,     // a configured size limit was hit
+    non_canonical,      // decodable, but not the canonical encoding
+    other,
+};
+
+inline const char* error_code_name(ErrorCode c) {
+    switch (c) {
+        case ErrorCode::none: return "none";
+        case ErrorCode::short_input: return "short_input";
+        case ErrorCode::bad_offset: return "bad_offset";
+        case ErrorCode::out_of_range: return "out_of_range";
+        case ErrorCode::buffer_too_small: return "buffer_too_small";
+        case ErrorCode::selector_mismatch: return "selector_mismatch";
+        case ErrorCode::invalid_text: return "invalid_text";
+        case ErrorCode::limit_exceeded: return "limit_exceeded";
+        case ErrorCode::non_canonical: return "non_canonical";
+        case ErrorCode::other: return "other";
+    }
+    return "other";
+}
+
+// Error message text. Decoders store a pointer to a string literal
+// (assign_static), so a failure never allocates; anything assigned through
+// operator= is copied. Compares and prints like a string.
+class ErrorText {
+public:
+    // lit must outlive the text: a string literal or other static storage
+    ErrorText& assign_static(const char* lit) {
+        lit_ = lit ? lit : "";
+        owned_.clear();
+        is_owned_ = false;
+        return *this;
+    }
+    ErrorText& operator=(const char* s) {
+        owned_ = s ? s : "";
+        is_owned_ = true;
+        return *this;
+    }
+    ErrorText& operator=(std::string s) {
+        owned_ = std::move(s);
+        is_owned_ = true;
+        return *this;
+    }
+    std::string_view view() const {
+        return is_owned_ ? std::string_view(owned_) : std::string_view(lit_);
+    }
+    const char* c_str() const {
+        return is_owned_ ? owned_.c_str() : lit_;
+    }
+    std::string str() const {
+        return std::string(view());
+    }
+    bool empty() const {
+        return view().empty();
+    }
+    size_t size() const {
+        return view().size();
+    }
+    friend bool operator==(const ErrorText& a, std::string_view b) {
+        return a.view() == b;
+    }
+    friend bool operator!=(const ErrorText& a, std::string_view b) {
+        return a.view() != b;
+    }
+    template <class Os>
+    friend auto operator<<(Os& os, const ErrorText& t)
+        -> decltype(os << std::string_view()) {
+        return os << t.view();
+    }
+
+private:
+    const char* lit_ = "";
+    std::string owned_;
+    bool is_owned_ = false;
+};
+
+// Where in a nested value a decode failed: one index per level, outermost
+// first (tuple field or array element). Filled in while the failure
+// unwinds, so the innermost max_depth levels are kept.
+struct ErrorPath {
+    static constexpr size_t max_depth = 8;
+    uint32_t idx[max_depth]{};  // innermost first
+    uint8_t depth = 0;
+    bool truncated = false;  // outer levels beyond max_depth were dropped
+
+    void clear() {
+        depth = 0;
+        truncated = false;
+    }
+    void push_outer(uint32_t i) {
+        if (depth == max_depth)
+            truncated = true;
+        else
+            idx[depth++] = i;
+    }
+    size_t size() const {
+        return depth;
+    }
+    uint32_t operator[](size_t level) const {
+        return idx[depth - 1 - level];
+    }
+};
+
+// Failure details. set() records the code and a message (a string literal
+// is kept by pointer, anything else copied); containers add their index and
+// base offset on the way out, so offset ends up as the byte position (in the
+// top-level input) of the value or word that failed. The readable form is
+// only built by to_string().
 struct Error {
-    std::string message, path;
+    ErrorCode code{};
     size_t offset{};
+    ErrorPath path;
+    ErrorText message;
+
+    template <size_t N>
+    void set(ErrorCode c, const char (&msg)[N], size_t off = 0) {
+        set_static(c, msg, off);
+    }
+    template <size_t N>
+    void set(ErrorCode c, char (&msg)[N], size_t off = 0) {  // a buffer
+        set(c, std::string(msg), off);
+    }
+    // msg is kept by pointer: a string literal or other static storage
+    void set_static(ErrorCode c, const char* msg, size_t off = 0) {
+        code = c;
+        message.assign_static(msg);
+        offset = off;
+        path.clear();
+    }
+    // Runtime-built message (cold paths only)
+    void set(ErrorCode c, std::string msg, size_t off = 0) {
+        code = c;
+        message = std::move(msg);
+        offset = off;
+        path.clear();
+    }
+    // Called by a container whose child i (starting at base) failed
+    void nest(uint32_t i, size_t base) {
+        path.push_outer(i);
+        offset += base;
+    }
+    void shift(size_t base) {
+        offset += base;
+    }
+
+    // "<message> (path 1.0.3, offset 224)"
+    std::string to_string() const {
+        std::string s = message.str();
+        s += " (";
+        if (path.size() || path.truncated) {
+            s += "path ";
+            if (path.truncated) s += "...";
+            for (size_t l = 0; l < path.size(); ++l) {
+                if (l) s += '.';
+                s += std::to_string(path[l]);
+            }
+            s += ", ";
+        }
+        s += "offset ";
+        s += std::to_string(offset);
+        s += ')';
+        return s;
+    }
 };
 
+// ----------------- decode limits -----------------
+// Caps on what one decode may allocate, for responses from untrusted
+// contracts. Lengths are always bounded by the input size; these bound the
+// total across the whole value tree.
+struct DecodeLimits {
+    size_t max_bytes = SIZE_MAX;     // bytes/string payloads + array storage
+    size_t max_elements = SIZE_MAX;  // array elements, summed over the tree
+    size_t max_depth = SIZE_MAX;     // nested arrays and tuples
+};
+
+namespace detail {
+
+struct DecodeBudget {
+    DecodeLimits limits;
+    size_t bytes = 0, elements = 0, depth = 0;
+
+    // Charge an allocation of n_bytes holding n_elems elements
+    bool take(size_t n_bytes, size_t n_elems, Error* e) {
+        if (n_bytes > limits.max_bytes - bytes) {
+            if (e) e->set(ErrorCode::limit_exceeded, "limits: too many bytes");
+            return false;
+        }
+        if (n_elems > limits.max_elements - elements) {
+            if (e)
+                e->set(ErrorCode::limit_exceeded, "limits: too many elements");
+            return false;
+        }
+        bytes += n_bytes;
+        elements += n_elems;
+        return true;
+    }
+};
+
+// Budget of the decode_from(..., limits, e) call running on this thread
+inline thread_local DecodeBudget* decode_budget = nullptr;
+
+// One container level; only counted while a budget is installed
+class DepthScope {
+public:
+    bool enter(Error* e) {
+        b_ = decode_budget;
+        if (!b_) return true;
+        if (b_->depth == b_->limits.max_depth) {
+            b_ = nullptr;
+            if (e) e->set(ErrorCode::limit_exceeded, "limits: too deep");
+            return false;
+        }
+        ++b_->depth;
+        return true;
+    }
+    ~DepthScope() {
+        if (b_) --b_->depth;
+    }
+
+private:
+    DecodeBudget* b_ = nullptr;
+};
+
+// Installs a fresh budget for the current thread until destroyed
+class BudgetScope {
+public:
+    explicit BudgetScope(const DecodeLimits& limits)
+        : budget_{limits}, saved_(decode_budget) {
+        decode_budget = &budget_;
+    }
+    ~BudgetScope() {
+        decode_budget = saved_;
+    }
+    BudgetScope(const BudgetScope&) = delete;
+    BudgetScope& operator=(const BudgetScope&) = delete;
+
+private:
+    DecodeBudget budget_;
+    DecodeBudget* saved_;
+};
+
+// Charge n payload bytes against the active budget, if any
+inline bool charge_bytes(size_t n, Error* e) {
+    DecodeBudget* b = decode_budget;
+    return !b || b->take(n, 0, e);
+}
+
+}  // namespace detail
+
 // Hex lookup table for efficient conversion
 static constexpr char hex_chars[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
                                        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
 
+namespace hex_detail {
+
+#if defined(__SSE2__)
+// 16 nibbles (one per byte, values 0..15) -> lowercase ASCII digits
+inline __m128i nibble_chars(__m128i nib) {
+    const __m128i gt9 = _mm_cmpgt_epi8(nib, _mm_set1_epi8(9));
+    return _mm_add_epi8(_mm_add_epi8(nib, _mm_set1_epi8('0')),
+                        _mm_and_si128(gt9, _mm_set1_epi8('a' - '0' - 10)));
+}
+#endif
+
+// Nibble value per character, 0xff for anything that is not a hex digit
+struct NibbleTable {
+    uint8_t v[256];
+    constexpr NibbleTable() : v{} {
+        for (int i = 0; i < 256; ++i) v[i] = 0xff;
+        for (int i = 0; i < 10; ++i) v['0' + i] = static_cast<uint8_t>(i);
+        for (int i = 0; i < 6; ++i) {
+            v['a' + i] = static_cast<uint8_t>(10 + i);
+            v['A' + i] = static_cast<uint8_t>(10 + i);
+        }
+    }
+};
+inline constexpr NibbleTable nibbles{};
+
+inline size_t first_invalid(const char* in, size_t n) {
+    size_t i = 0;
+    while (i < n && nibbles.v[static_cast<uint8_t>(in[i])] != 0xff) ++i;
+    return i;
+}
+
+#if defined(__SSE2__)
+// 16 ASCII hex digits -> nibble values; bad gets 0xff in invalid lanes
+inline __m128i char_nibbles(__m128i c, __m128i& bad) {
+    const __m128i d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    const __m128i l = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)),
+                                   _mm_set1_epi8('a'));
+    const __m128i is_d = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    const __m128i is_l = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+    bad = _mm_or_si128(bad, _mm_andnot_si128(_mm_or_si128(is_d, is_l),
+                                             _mm_set1_epi8(-1)));
+    return _mm_or_si128(
+        _mm_and_si128(is_d, d),
+        _mm_and_si128(is_l, _mm_add_epi8(l, _mm_set1_epi8(10))));
+}
+
+// Pairs of nibbles (high first) -> 16-bit lanes holding one byte each
+inline __m128i join_nibbles(__m128i nib) {
+#if defined(__SSSE3__)
+    return _mm_maddubs_epi16(nib, _mm_set1_epi16(0x0110));
+#else
+    const __m128i hi = _mm_and_si128(nib, _mm_set1_epi16(0x00ff));
+    return _mm_or_si128(_mm_slli_epi16(hi, 4), _mm_srli_epi16(nib, 8));
+#endif
+}
+#endif
+
+#if defined(__AVX2__)
+inline __m256i char_nibbles(__m256i c, __m256i& bad) {
+    const __m256i d = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+    const __m256i l = _mm256_sub_epi8(
+        _mm256_or_si256(c, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const __m256i is_d =
+        _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+    const __m256i is_l =
+        _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+    bad = _mm256_or_si256(bad, _mm256_andnot_si256(_mm256_or_si256(is_d, is_l),
+                                                   _mm256_set1_epi8(-1)));
+    return _mm256_or_si256(
+        _mm256_and_si256(is_d, d),
+        _mm256_and_si256(is_l, _mm256_add_epi8(l, _mm256_set1_epi8(10))));
+}
+#endif
+
+}  // namespace hex_detail
+
+// Decode n_chars hex digits (even, no prefix; either case) into
+// out[n_chars / 2]. Returns false on an invalid character and stores its
+// index in *bad; out is then unspecified. out may equal in.
+inline bool hex_decode(const char* in, size_t n_chars, uint8_t* out,
+                       size_t* bad = nullptr) {
+    const size_t n = n_chars / 2;
+    size_t i = 0;  // output bytes done
+    bool ok = true;
+#if defined(__AVX2__)
+    {
+        __m256i badv = _mm256_setzero_si256();
+        for (; i + 16 <= n; i += 16) {
+            const __m256i c = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(in + 2 * i));
+            const __m256i nib = hex_detail::char_nibbles(c, badv);
+            const __m256i w =
+                _mm256_maddubs_epi16(nib, _mm256_set1_epi16(0x0110));
+            const __m256i packed = _mm256_permute4x64_epi64(
+                _mm256_packus_epi16(w, w), 0xd8);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                             _mm256_castsi256_si128(packed));
+        }
+        ok = _mm256_testz_si256(badv, badv);
+    }
+#endif
+#if defined(__SSE2__)
+    {
+        __m128i badv = _mm_setzero_si128();
+        for (; i + 8 <= n; i += 8) {
+            const __m128i c =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i));
+            const __m128i w =
+                hex_detail::join_nibbles(hex_detail::char_nibbles(c, badv));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i),
+                             _mm_packus_epi16(w, w));
+        }
+        ok = ok && _mm_movemask_epi8(badv) == 0;
+    }
+#endif
+    const uint8_t* t = hex_detail::nibbles.v;
+    uint8_t acc = 0;  // high bit set once any invalid character was seen
+    // Walk pointers to the end so GCC can bound the trip count
+    const char* p = in + 2 * i;
+    for (uint8_t* o = out + i; o != out + n; ++o, p += 2) {
+        const uint8_t hi = t[static_cast<uint8_t>(p[0])];
+        const uint8_t lo = t[static_cast<uint8_t>(p[1])];
+        acc |= hi | lo;
+        *o = static_cast<uint8_t>((hi << 4) | (lo & 0x0f));
+    }
+    if (!ok || (acc & 0x80)) {
+        if (bad) *bad = hex_detail::first_invalid(in, 2 * n);
+        return false;
+    }
+    return true;
+}
+
+// Write 2 * n lowercase hex digits of in[0, n) to out (no prefix, no
+// terminator). The output may overlap the input when in >= out + n, which
+// lets callers expand bytes stored in the back half of the output buffer.
+inline void hex_encode(const uint8_t* in, size_t n, char* out) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), mask);
+        const __m256i lo = _mm256_and_si256(v, mask);
+        const __m256i gt9h = _mm256_cmpgt_epi8(hi, _mm256_set1_epi8(9));
+        const __m256i gt9l = _mm256_cmpgt_epi8(lo, _mm256_set1_epi8(9));
+        const __m256i adj = _mm256_set1_epi8('a' - '0' - 10);
+        const __m256i zero = _mm256_set1_epi8('0');
+        const __m256i hc = _mm256_add_epi8(_mm256_add_epi8(hi, zero),
+                                           _mm256_and_si256(gt9h, adj));
+        const __m256i lc = _mm256_add_epi8(_mm256_add_epi8(lo, zero),
+                                           _mm256_and_si256(gt9l, adj));
+        // unpack works per 128-bit lane; reassemble bytes 0-15 / 16-31
+        const __m256i a = _mm256_unpacklo_epi8(hc, lc);
+        const __m256i b = _mm256_unpackhi_epi8(hc, lc);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i),
+                            _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + 32),
+                            _mm256_permute2x128_si256(a, b, 0x31));
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i mask16 = _mm_set1_epi8(0x0f);
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i hc = hex_detail::nibble_chars(
+            _mm_and_si128(_mm_srli_epi16(v, 4), mask16));
+        const __m128i lc =
+            hex_detail::nibble_chars(_mm_and_si128(v, mask16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i),
+                         _mm_unpacklo_epi8(hc, lc));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16),
+                         _mm_unpackhi_epi8(hc, lc));
+    }
+#endif
+    for (; i < n; ++i) {
+        const uint8_t b = in[i];
+        out[2 * i] = hex_chars[b >> 4];
+        out[2 * i + 1] = hex_chars[b & 0x0f];
+    }
+}
+
 /**
  * Parse hex string to byte vector
  * Supports both "0x" prefixed and raw hex strings
@@ -83,26 +527,15 @@ inline std::vector<uint8_t> parse_hex(const std::string& h) {
     size_t i = (h.size() >= 2 && (h[0] == '0') && (h[1] == 'x' || h[1] == 'X'))
                    ? 2
                    : 0;
-    std::vector<uint8_t> out;
-    out.reserve((h.size() - i + 1) / 2);
+    std::vector<uint8_t> out((h.size() - i + 1) / 2);
+    size_t o = 0;
 
     // Handle odd-length hex strings
     if (((h.size() - i) & 1) != 0) {
-        auto c = h[i];
-        auto nib = (c >= '0' && c <= '9') ? (c - '0') : (10 + ((c | 32) - 'a'));
-        out.push_back(static_cast<uint8_t>(nib));
+        out[o++] = hex_detail::nibbles.v[static_cast<uint8_t>(h[i])] & 0x0f;
         ++i;
     }
-
-    auto nib = [](char c) -> uint8_t {
-        if (c >= '0' && c <= '9') return static_cast<uint8_t>(c - '0');
-        c |= 32;
-        return static_cast<uint8_t>(10 + (c - 'a'));
-    };
-
-    for (; i + 1 < h.size(); i += 2) {
-        out.push_back(static_cast<uint8_t>((nib(h[i]) << 4) | nib(h[i + 1])));
-    }
+    hex_decode(h.data() + i, h.size() - i, out.data() + o);
     return out;
 }
 
@@ -126,14 +559,9 @@ inline std::array<uint8_t, 20> addr_from_hex(const std::string& addr) {
  * Convert address to hex string with 0x prefix
  */
 inline std::string addr_to_hex_string(const std::array<uint8_t, 20>& addr) {
-    std::string result;
-    result.reserve(42);  // "0x" + 40 hex chars for 20 bytes
-    result = "0x";
-
-    for (uint8_t byte : addr) {
-        result.push_back(hex_chars[byte >> 4]);
-        result.push_back(hex_chars[byte & 0x0F]);
-    }
+    std::string result(42, '0');  // "0x" + 40 hex chars for 20 bytes
+    result[1] = 'x';
+    hex_encode(addr.data(), 20, result.data() + 2);
     return result;
 }
 
@@ -141,14 +569,9 @@ inline std::string addr_to_hex_string(const std::array<uint8_t, 20>& addr) {
  * Convert bytes to hex string with 0x prefix (most efficient version)
  */
 inline std::string bytes_to_hex_string(const std::vector<uint8_t>& bytes) {
-    std::string result;
-    result.reserve(2 + bytes.size() * 2);  // "0x" + 2 chars per byte
-    result = "0x";
-
-    for (uint8_t byte : bytes) {
-        result.push_back(hex_chars[byte >> 4]);
-        result.push_back(hex_chars[byte & 0x0F]);
-    }
+    std::string result(2 + bytes.size() * 2, '0');  // "0x" + 2 chars per byte
+    result[1] = 'x';
+    hex_encode(bytes.data(), bytes.size(), result.data() + 2);
     return result;
 }
 
@@ -157,14 +580,9 @@ inline std::string bytes_to_hex_string(const std::vector<uint8_t>& bytes) {
  */
 template <size_t N>
 inline std::string bytes_to_hex_string(const std::array<uint8_t, N>& bytes) {
-    std::string result;
-    result.reserve(2 + N * 2);  // "0x" + 2 chars per byte
-    result = "0x";
-
-    for (uint8_t byte : bytes) {
-        result.push_back(hex_chars[byte >> 4]);
-        result.push_back(hex_chars[byte & 0x0F]);
-    }
+    std::string result(2 + N * 2, '0');  // "0x" + 2 chars per byte
+    result[1] = 'x';
+    hex_encode(bytes.data(), N, result.data() + 2);
     return result;
 }
 
@@ -172,15 +590,9 @@ inline std::string bytes_to_hex_string(const std::array<uint8_t, N>& bytes) {
  * Convert bytes to hex string with 0x prefix (raw bytes - most efficient)
  */
 inline std::string bytes_to_hex_string(BytesSpan bytes) {
-    std::string result;
-    result.reserve(2 + bytes.size() * 2);  // "0x" + 2 chars per byte
-    result = "0x";
-
-    for (size_t i = 0; i < bytes.size(); ++i) {
-        uint8_t byte = bytes[i];
-        result.push_back(hex_chars[byte >> 4]);
-        result.push_back(hex_chars[byte & 0x0F]);
-    }
+    std::string result(2 + bytes.size() * 2, '0');  // "0x" + 2 chars per byte
+    result[1] = 'x';
+    hex_encode(bytes.data(), bytes.size(), result.data() + 2);
     return result;
 }
 
@@ -209,45 +621,85 @@ struct tuple {};
 template <class Schema>
 struct traits;
 // ----------------- default value mapping -----------------
-template <class T>
+// C picks the containers bytes, string_t and dyn_array map to.
+// pmr_containers makes a whole value tree allocate from one
+// std::pmr::memory_resource (e.g. a per-block monotonic arena); construct
+// the top-level value with the resource and nested values inherit it.
+// Integers stay cpp_int; generated named structs with bytes, string or array
+// members map to their allocator-aware twin in abi::protocols::pmr.
+struct std_containers {
+    template <class T>
+    using vector = std::vector<T>;
+    using string = std::string;
+};
+struct pmr_containers {
+    template <class T>
+    using vector = std::pmr::vector<T>;
+    using string = std::pmr::string;
+};
+
+template <class T, class C = std_containers>
 struct value_of;
-template <int N>
-struct value_of<uint_t<N>> {
+template <int N, class C>
+struct value_of<uint_t<N>, C> {
     using type = boost::multiprecision::cpp_int;
 };
-template <int N>
-struct value_of<int_t<N>> {
+template <int N, class C>
+struct value_of<int_t<N>, C> {
     using type = boost::multiprecision::cpp_int;
 };
-template <>
-struct value_of<bool_t> {
+template <class C>
+struct value_of<bool_t, C> {
     using type = bool;
 };
-template <>
-struct value_of<address20> {
+template <class C>
+struct value_of<address20, C> {
     using type = std::array<uint8_t, 20>;
 };
-template <>
-struct value_of<bytes> {
-    using type = std::vector<uint8_t>;
+template <class C>
+struct value_of<bytes, C> {
+    using type = typename C::template vector<uint8_t>;
 };
-template <>
-struct value_of<string_t> {
-    using type = std::string;
+template <class C>
+struct value_of<string_t, C> {
+    using type = typename C::string;
 };
-template <class T, size_t N>
-struct value_of<static_array<T, N>> {
-    using type = std::array<typename value_of<T>::type, N>;
+template <class T, size_t N, class C>
+struct value_of<static_array<T, N>, C> {
+    using type = std::array<typename value_of<T, C>::type, N>;
 };
-template <class T>
-struct value_of<dyn_array<T>> {
-    using type = std::vector<typename value_of<T>::type>;
+template <class T, class C>
+struct value_of<dyn_array<T>, C> {
+    using type = typename C::template vector<typename value_of<T, C>::type>;
 };
-template <class... Ts>
-struct value_of<tuple<Ts...>> {
-    using type = std::tuple<typename value_of<Ts>::type...>;
+template <class... Ts, class C>
+struct value_of<tuple<Ts...>, C> {
+    using type = std::tuple<typename value_of<Ts, C>::type...>;
 };
 
+// Value type of Schema with std::pmr containers
+template <class S>
+using pmr_value_t = typename value_of<S, pmr_containers>::type;
+
+namespace detail {
+
+// Constructs a T from args, passing a along when T is allocator-aware (the
+// uses-allocator construction a pmr container applies to its elements).
+// Used by the members of allocator-aware named structs.
+template <class T, class A, class... Args>
+T make_with_allocator(const A& a, Args&&... args) {
+    if constexpr (!std::uses_allocator_v<T, A>) {
+        return T(std::forward<Args>(args)...);
+    } else if constexpr (std::is_constructible_v<T, std::allocator_arg_t,
+                                                 const A&, Args...>) {
+        return T(std::allocator_arg, a, std::forward<Args>(args)...);
+    } else {
+        return T(std::forward<Args>(args)..., a);
+    }
+}
+
+}  // namespace detail
+
 // Convenience alias for cleaner field type declarations
 template <class S>
 using cpp_t = typename value_of<S>::type;
@@ -303,6 +755,61 @@ inline boost::multiprecision::cpp_int read_u256_big(const uint8_t* in) {
     }
     return x;
 }
+
+// Read an offset/length word; fails if the value does not fit in 64 bits
+inline bool read_size_word(const uint8_t* in, size_t& out) {
+    for (int i = 0; i < 24; ++i) {
+        if (in[i]) return false;
+    }
+    uint64_t v = 0;
+    for (int i = 24; i < 32; ++i) v = (v << 8) | in[i];
+    out = static_cast<size_t>(v);
+    return true;
+}
+
+// Low 64 bits of an offset/length word, unchecked (trusted decode)
+inline size_t load_size_word(const uint8_t* in) {
+    uint64_t v;
+    std::memcpy(&v, in + 24, 8);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return static_cast<size_t>(v);
+}
+
+// ----------------- native 256-bit word -----------------
+// Fixed-width unsigned 256-bit value for the native (non cpp_int) fast paths
+struct u256 {
+    std::array<uint64_t, 4> limbs{};  // little-endian: limbs[0] is lowest
+
+    static u256 from_be(const uint8_t* in) {
+        u256 r;
+        for (int i = 0; i < 4; ++i) {
+            uint64_t v;
+            std::memcpy(&v, in + 8 * (3 - i), 8);
+            r.limbs[i] = __builtin_bswap64(v);
+        }
+        return r;
+    }
+    void to_be(uint8_t* out) const {
+        for (int i = 0; i < 4; ++i) {
+            const uint64_t v = __builtin_bswap64(limbs[i]);
+            std::memcpy(out + 8 * (3 - i), &v, 8);
+        }
+    }
+    boost::multiprecision::cpp_int to_cpp_int() const {
+        boost::multiprecision::cpp_int r = limbs[3];
+        for (int i = 2; i >= 0; --i) r = (r << 64) | limbs[i];
+        return r;
+    }
+    bool operator==(const u256& o) const {
+        return limbs == o.limbs;
+    }
+    bool operator!=(const u256& o) const {
+        return limbs != o.limbs;
+    }
+};
+
 template <int N>
 inline boost::multiprecision::cpp_int sign_extend(
     const boost::multiprecision::cpp_int& x) {
@@ -317,6 +824,58 @@ inline boost::multiprecision::cpp_int sign_extend(
     }
     return v;
 }
+// Store a 256-bit magnitude (negated when neg) in x. The limbs x already
+// owns are reused, so repeated decodes into the same value stop allocating
+// once it has held a wide one.
+inline void assign_u256(boost::multiprecision::cpp_int& x, const u256& m,
+                        bool neg = false) {
+    auto& be = x.backend();
+    using limb_t = std::decay_t<decltype(*be.limbs())>;
+    constexpr unsigned per = sizeof(limb_t) * 8;
+    constexpr unsigned n = 256 / per;
+    be.resize(n, n);
+    limb_t* l = be.limbs();
+    for (unsigned i = 0; i < n; ++i)
+        l[i] = static_cast<limb_t>(m.limbs[i * per / 64] >> (i * per % 64));
+    be.normalize();
+    be.sign(neg);
+}
+
+// In-place read_u256_big
+inline void read_u256_big(const uint8_t* in,
+                          boost::multiprecision::cpp_int& out) {
+    assign_u256(out, u256::from_be(in));
+}
+
+// In-place sign_extend<N>(read_u256_big(in))
+template <int N>
+inline void read_int_big(const uint8_t* in,
+                         boost::multiprecision::cpp_int& out) {
+    static_assert(N >= 1 && N <= 256, "int bits");
+    auto low_bits = [](u256& v) {
+        for (int i = 0; i < 4; ++i) {
+            const int keep = N - 64 * i;
+            if (keep <= 0)
+                v.limbs[i] = 0;
+            else if (keep < 64)
+                v.limbs[i] &= (uint64_t(1) << keep) - 1;
+        }
+    };
+    u256 v = u256::from_be(in);
+    low_bits(v);
+    const bool neg = (v.limbs[(N - 1) / 64] >> ((N - 1) % 64)) & 1;
+    if (neg) {
+        // magnitude 2^N - v: two's complement, then back to N bits
+        uint64_t carry = 1;
+        for (int i = 0; i < 4; ++i) {
+            v.limbs[i] = ~v.limbs[i] + carry;
+            carry = carry && v.limbs[i] == 0;
+        }
+        low_bits(v);
+    }
+    assign_u256(out, v, neg);
+}
+
 inline void write_bytes_padded(uint8_t* out, BytesSpan b) {
     if (b.size()) {
         // Use fast memcpy for 32-byte aligned operations
@@ -332,12 +891,35 @@ inline void write_bytes_padded(uint8_t* out, BytesSpan b) {
     size_t pad = pad32(b.size()) - b.size();
     if (pad) std::memset(out + b.size(), 0, pad);
 }
-inline BytesSpan as_bytes_span(const std::vector<uint8_t>& v) {
+template <class A>
+inline BytesSpan as_bytes_span(const std::vector<uint8_t, A>& v) {
     return {v.data(), v.size()};
 }
-inline BytesSpan as_bytes_span(const std::string& s) {
+template <class A>
+inline BytesSpan as_bytes_span(
+    const std::basic_string<char, std::char_traits<char>, A>& s) {
     return {reinterpret_cast<const uint8_t*>(s.data()), s.size()};
 }
+inline BytesSpan as_bytes_span(BytesSpan s) {
+    return s;
+}
+
+// Element count of a forward range; uses size() when the range provides it
+template <class R, class = void>
+struct has_size_member : std::false_type {};
+template <class R>
+struct has_size_member<
+    R, std::void_t<decltype(std::declval<const R&>().size())>>
+    : std::true_type {};
+
+template <class R>
+inline size_t range_size(const R& r) {
+    if constexpr (has_size_member<R>::value) {
+        return static_cast<size_t>(r.size());
+    } else {
+        return static_cast<size_t>(std::distance(std::begin(r), std::end(r)));
+    }
+}
 
 template <class S>
 struct needs_top_ptr : std::false_type {};
@@ -354,6 +936,26 @@ template <class T, size_t N>
 struct needs_top_ptr<static_array<T, N>>
     : std::bool_constant<traits<T>::is_dynamic> {};
 
+// ----------------- decode policy -----------------
+// Template argument of traits<>::decode, decode_from and Fn::decode_*.
+// checked (the default) validates every length, offset and ordering rule
+// and enforces DecodeLimits. trusted is for input produced by an encoder we
+// control (our own archive, a local node we encoded for): it skips all of
+// that, reads size words from their low 8 bytes and walks dynamic data with
+// plain offsets; malformed input is undefined behaviour.
+struct checked {
+    static constexpr bool verify = true;
+};
+struct trusted {
+    static constexpr bool verify = false;
+};
+
+template <class T, class = void>
+struct is_decode_policy : std::false_type {};
+template <class T>
+struct is_decode_policy<T, std::void_t<decltype(T::verify)>>
+    : std::true_type {};
+
 // ----------------- traits primary -----------------
 template <class Schema>
 struct traits;
@@ -375,10 +977,13 @@ struct traits<bool_t> {
     template <class V>
     static void encode_tail(uint8_t*, size_t, const V&) {
     }
+    template <class P = checked>
     static bool decode(BytesSpan in, bool& out, Error* e = nullptr) {
-        if (in.size() < 32) {
-            if (e) e->message = "bool: short";
-            return false;
+        if constexpr (P::verify) {
+            if (in.size() < 32) {
+                if (e) e->set(ErrorCode::short_input, "bool: short");
+                return false;
+            }
         }
         out = (in.data()[31] != 0);
         return true;
@@ -407,11 +1012,14 @@ struct traits<address20> {
     template <class V>
     static void encode_tail(uint8_t*, size_t, const V&) {
     }
+    template <class P = checked>
     static bool decode(BytesSpan in, std::array<uint8_t, 20>& out,
                        Error* e = nullptr) {
-        if (in.size() < 32) {
-            if (e) e->message = "address: short";
-            return false;
+        if constexpr (P::verify) {
+            if (in.size() < 32) {
+                if (e) e->set(ErrorCode::short_input, "address: short");
+                return false;
+            }
         }
         std::memcpy(out.data(), in.data() + 12, 20);
         return true;
@@ -438,13 +1046,16 @@ struct traits<uint_t<N>> {
     template <class V>
     static void encode_tail(uint8_t*, size_t, const V&) {
     }
+    template <class P = checked>
     static bool decode(BytesSpan in, typename value_of<uint_t<N>>::type& out,
                        Error* e = nullptr) {
-        if (in.size() < 32) {
-            if (e) e->message = "uintN: short";
-            return false;
+        if constexpr (P::verify) {
+            if (in.size() < 32) {
+                if (e) e->set(ErrorCode::short_input, "uintN: short");
+                return false;
+            }
         }
-        out = read_u256_big(in.data());
+        read_u256_big(in.data(), out);
         return true;
     }
 };
@@ -466,13 +1077,16 @@ struct traits<int_t<N>> {
     template <class V>
     static void encode_tail(uint8_t*, size_t, const V&) {
     }
+    template <class P = checked>
     static bool decode(BytesSpan in, typename value_of<int_t<N>>::type& out,
                        Error* e = nullptr) {
-        if (in.size() < 32) {
-            if (e) e->message = "intN: short";
-            return false;
+        if constexpr (P::verify) {
+            if (in.size() < 32) {
+                if (e) e->set(ErrorCode::short_input, "intN: short");
+                return false;
+            }
         }
-        out = sign_extend<N>(read_u256_big(in.data()));
+        read_int_big<N>(in.data(), out);
         return true;
     }
 };
@@ -496,17 +1110,23 @@ struct traits<bytes> {
         write_u256_imm(out + base, s.size());
         write_bytes_padded(out + base + 32, s);
     }
-    static bool decode(BytesSpan in, std::vector<uint8_t>& out,
+    template <class P = checked, class A>
+    static bool decode(BytesSpan in, std::vector<uint8_t, A>& out,
                        Error* e = nullptr) {
-        if (in.size() < 32) {
-            if (e) e->message = "bytes: short";
-            return false;
-        }
-        auto len = static_cast<size_t>(
-            read_u256_big(in.data()).convert_to<unsigned long long>());
-        if (in.size() < 32 + len) {
-            if (e) e->message = "bytes: len out of range";
-            return false;
+        size_t len = 0;
+        if constexpr (P::verify) {
+            if (in.size() < 32) {
+                if (e) e->set(ErrorCode::short_input, "bytes: short");
+                return false;
+            }
+            if (!read_size_word(in.data(), len) || len > in.size() - 32) {
+                if (e)
+                    e->set(ErrorCode::out_of_range, "bytes: len out of range");
+                return false;
+            }
+            if (!detail::charge_bytes(len, e)) return false;
+        } else {
+            len = load_size_word(in.data());
         }
         out.resize(len);
         if (len) std::memcpy(out.data(), in.data() + 32, len);
@@ -518,29 +1138,37 @@ template <>
 struct traits<string_t> {
     static constexpr bool is_dynamic = true;
     static constexpr size_t head_words = 1;
-    static size_t tail_size(const std::string& v) {
+    static size_t tail_size(std::string_view v) {
         return 32 + pad32(v.size());
     }
-    static void encode_head(uint8_t* out32, size_t, const std::string&,
+    static void encode_head(uint8_t* out32, size_t, std::string_view,
                             size_t base) {
         write_u256_imm(out32, base);
     }
-    static void encode_tail(uint8_t* out, size_t base, const std::string& v) {
+    static void encode_tail(uint8_t* out, size_t base, std::string_view v) {
         write_u256_imm(out + base, v.size());
         if (!v.empty()) std::memcpy(out + base + 32, v.data(), v.size());
         size_t pad = pad32(v.size()) - v.size();
         if (pad) std::memset(out + base + 32 + v.size(), 0, pad);
     }
-    static bool decode(BytesSpan in, std::string& out, Error* e = nullptr) {
-        if (in.size() < 32) {
-            if (e) e->message = "string: short";
-            return false;
-        }
-        auto len = static_cast<size_t>(
-            read_u256_big(in.data()).convert_to<unsigned long long>());
-        if (in.size() < 32 + len) {
-            if (e) e->message = "string: len out of range";
-            return false;
+    template <class P = checked, class A>
+    static bool decode(BytesSpan in,
+                       std::basic_string<char, std::char_traits<char>, A>& out,
+                       Error* e = nullptr) {
+        size_t len = 0;
+        if constexpr (P::verify) {
+            if (in.size() < 32) {
+                if (e) e->set(ErrorCode::short_input, "string: short");
+                return false;
+            }
+            if (!read_size_word(in.data(), len) || len > in.size() - 32) {
+                if (e)
+                    e->set(ErrorCode::out_of_range, "string: len out of range");
+                return false;
+            }
+            if (!detail::charge_bytes(len, e)) return false;
+        } else {
+            len = load_size_word(in.data());
         }
         out.assign(reinterpret_cast<const char*>(in.data() + 32), len);
         return true;
@@ -587,22 +1215,40 @@ struct traits<static_array<T, N>> {
         }
     }
 
-    static bool decode(BytesSpan in,
-                       typename value_of<static_array<T, N>>::type& out,
+    template <class P = checked, class E>
+    static bool decode(BytesSpan in, std::array<E, N>& out,
                        Error* e = nullptr) {
+        if constexpr (!P::verify) {
+            constexpr size_t stride = 32 * traits<T>::head_words;
+            for (size_t i = 0; i < N; ++i) {
+                if constexpr (elem_dyn) {
+                    const size_t off = load_size_word(in.data() + 32 * i);
+                    traits<T>::template decode<P>(
+                        BytesSpan(in.data() + off, in.size() - off), out[i], e);
+                } else {
+                    traits<T>::template decode<P>(
+                        BytesSpan(in.data() + stride * i, stride), out[i], e);
+                }
+            }
+            return true;
+        }
+        detail::DepthScope depth;
+        if (!depth.enter(e)) return false;
         if constexpr (!elem_dyn) {
             const size_t need = 32 * traits<T>::head_words * N;
             if (in.size() < need) {
-                if (e) e->message = "static_array: short";
+                if (e) e->set(ErrorCode::short_input, "static_array: short");
                 return false;
             }
 
             size_t off = 0;
             for (size_t i = 0; i < N; ++i) {
-                if (!traits<T>::decode(
+                if (!traits<T>::template decode<P>(
                         BytesSpan(in.data() + off, 32 * traits<T>::head_words),
-                        out[i], e))
+                        out[i], e)) {
+                    if (e) e->nest(uint32_t(i), off);
                     return false;
+                }
                 off += 32 * traits<T>::head_words;
             }
             return true;
@@ -611,27 +1257,25 @@ struct traits<static_array<T, N>> {
             // THE START OF THIS ARRAY ENCODING
             const size_t head_bytes = 32 * N;
             if (in.size() < head_bytes) {
-                if (e) e->message = "static_array(dyn): head short";
+                if (e)
+                    e->set(ErrorCode::short_input,
+                           "static_array(dyn): head short");
                 return false;
             }
 
             // collect offsets
             std::array<size_t, N + 1> offs{};
             for (size_t i = 0; i < N; ++i) {
-                size_t oi =
-                    static_cast<size_t>(read_u256_big(in.data() + 32 * i)
-                                            .convert_to<unsigned long long>());
+                size_t oi = 0;
                 // must point somewhere within the array slice
-                if (oi > in.size()) {
-                    if (e) e->message = "static_array(dyn): bad off";
+                if (!read_size_word(in.data() + 32 * i, oi) || oi > in.size()) {
+                    if (e)
+                        e->set(ErrorCode::bad_offset,
+                               "static_array(dyn): bad off", 32 * i);
                     return false;
                 }
-                // sanity: usually at/after head
-                if (oi <
-                    head_bytes) { /* allow or enforce; if you want strictness:
-                                     if(e) e->message="static_array(dyn): off <
-                                     head"; return false; */
-                }
+                // Offsets into the head are tolerated, as other decoders
+                // do; validate_canonical (canonical.h) rejects them
                 offs[i] = oi;
             }
             offs[N] = in.size();  // sentinel end
@@ -641,13 +1285,17 @@ struct traits<static_array<T, N>> {
                 size_t start = offs[i];
                 size_t stop = offs[i + 1];
                 if (stop < start) {
-                    if (e) e->message = "static_array(dyn): off order";
+                    if (e)
+                        e->set(ErrorCode::bad_offset,
+                               "static_array(dyn): off order", 32 * i);
                     return false;
                 }
                 size_t span = stop - start;
-                if (!traits<T>::decode(BytesSpan(in.data() + start, span),
-                                       out[i], e))
+                if (!traits<T>::template decode<P>(
+                        BytesSpan(in.data() + start, span), out[i], e)) {
+                    if (e) e->nest(uint32_t(i), start);
                     return false;
+                }
             }
             return true;
         }
@@ -661,14 +1309,18 @@ struct traits<dyn_array<T>> {
     static constexpr bool is_dynamic = true;
     static constexpr size_t head_words = 1;
 
+    // V may be any multi-pass forward range (container, Span, view) whose
+    // elements, by value or by reference, are encodable as T. It is walked
+    // several times (size, encoded_size, encode), so single-pass input
+    // ranges such as generators are not supported.
     template <class V>
     static size_t tail_size(const V& v) {
-        size_t bytes = 32;  // length
-        if (elem_dyn) {
-            bytes += 32 * v.size();
-            for (const auto& e : v) bytes += traits<T>::tail_size(e);
+        const size_t n = range_size(v);
+        size_t bytes = 32 + 32 * n;  // length + offsets / inline heads
+        if constexpr (elem_dyn) {
+            for (auto&& e : v) bytes += traits<T>::tail_size(e);
         } else {
-            bytes += 32 * traits<T>::head_words * v.size();
+            bytes += 32 * (traits<T>::head_words - 1) * n;
         }
         return bytes;
     }
@@ -680,68 +1332,101 @@ struct traits<dyn_array<T>> {
 
     template <class V>
     static void encode_tail(uint8_t* out, size_t base, const V& v) {
-        write_u256_imm(out + base, v.size());
-        size_t cursor = base + 32;
-
-        if (elem_dyn) {
-            size_t running = 32 * v.size();
-            for (size_t i = 0; i < v.size(); ++i) {
-                write_u256_imm(out + cursor + 32 * i, running);
-                traits<T>::encode_tail(out, base + 32 + running, v[i]);
-                running += traits<T>::tail_size(v[i]);
+        const size_t n = range_size(v);
+        write_u256_imm(out + base, n);
+        uint8_t* cursor = out + base + 32;
+
+        if constexpr (elem_dyn) {
+            // offsets and tails in one walk over v
+            size_t running = 32 * n;
+            for (auto&& e : v) {
+                write_u256_imm(cursor, running);
+                traits<T>::encode_tail(out, base + 32 + running, e);
+                running += traits<T>::tail_size(e);
+                cursor += 32;
             }
         } else {
             // Fix: use full stride for static elements
             const size_t stride = 32 * traits<T>::head_words;
-            for (size_t i = 0; i < v.size(); ++i) {
-                traits<T>::encode_head(out + cursor + i * stride, 0, v[i], 0);
+            for (auto&& e : v) {
+                traits<T>::encode_head(cursor, 0, e, 0);
+                cursor += stride;
             }
         }
     }
 
-    static bool decode(BytesSpan in, typename value_of<dyn_array<T>>::type& out,
+    template <class P = checked, class E, class A>
+    static bool decode(BytesSpan in, std::vector<E, A>& out,
                        Error* e = nullptr) {
+        if constexpr (!P::verify) {
+            // Heads (offsets or inline elements) start after the length;
+            // offsets are relative to the first head
+            const uint8_t* heads = in.data() + 32;
+            const size_t rest = in.size() - 32;
+            const size_t len = load_size_word(in.data());
+            out.resize(len);
+            constexpr size_t stride = 32 * traits<T>::head_words;
+            for (size_t i = 0; i < len; ++i) {
+                if constexpr (elem_dyn) {
+                    const size_t off = load_size_word(heads + 32 * i);
+                    traits<T>::template decode<P>(
+                        BytesSpan(heads + off, rest - off), out[i], e);
+                } else {
+                    traits<T>::template decode<P>(
+                        BytesSpan(heads + stride * i, stride), out[i], e);
+                }
+            }
+            return true;
+        }
         if (in.size() < 32) {
-            if (e) e->message = "dyn_array: short";
+            if (e) e->set(ErrorCode::short_input, "dyn_array: short");
             return false;
         }
 
-        size_t len = static_cast<size_t>(
-            read_u256_big(in.data()).convert_to<unsigned long long>());
+        detail::DepthScope depth;
+        if (!depth.enter(e)) return false;
+
+        // Every element takes at least one head word, so a length the input
+        // cannot hold is rejected before anything is allocated
+        constexpr size_t stride = elem_dyn ? 32 : 32 * traits<T>::head_words;
+        size_t len = 0;
+        if (!read_size_word(in.data(), len) ||
+            len > (in.size() - 32) / stride) {
+            if (e)
+                e->set_static(ErrorCode::short_input,
+                              elem_dyn ? "dyn_array: offs short"
+                                       : "dyn_array: inline short");
+            return false;
+        }
+        if (detail::DecodeBudget* b = detail::decode_budget) {
+            if (!b->take(len * sizeof(E), len, e)) return false;
+        }
         out.resize(len);
 
         if constexpr (!elem_dyn) {
-            const size_t need = 32 + 32 * traits<T>::head_words * len;
-            if (in.size() < need) {
-                if (e) e->message = "dyn_array: inline short";
-                return false;
-            }
             size_t off = 32;
             for (size_t i = 0; i < len; ++i) {
-                if (!traits<T>::decode(
+                if (!traits<T>::template decode<P>(
                         BytesSpan(in.data() + off, 32 * traits<T>::head_words),
-                        out[i], e))
+                        out[i], e)) {
+                    if (e) e->nest(uint32_t(i), off);
                     return false;
+                }
                 off += 32 * traits<T>::head_words;
             }
             return true;
         } else {
             // (keep your corrected dynamic-element decode with base = 32 and
             // bounded slices)
-            const size_t head_bytes = 32 + 32 * len;
-            if (in.size() < head_bytes) {
-                if (e) e->message = "dyn_array: offs short";
-                return false;
-            }
-
             const size_t base = 32;
             std::vector<size_t> offs(len + 1);
             for (size_t i = 0; i < len; ++i) {
-                size_t oi =
-                    static_cast<size_t>(read_u256_big(in.data() + 32 + 32 * i)
-                                            .convert_to<unsigned long long>());
-                if (base + oi > in.size()) {
-                    if (e) e->message = "dyn_array: bad off";
+                size_t oi = 0;
+                if (!read_size_word(in.data() + 32 + 32 * i, oi) ||
+                    oi > in.size() - base) {
+                    if (e)
+                        e->set(ErrorCode::bad_offset, "dyn_array: bad off",
+                               32 + 32 * i);
                     return false;
                 }
                 offs[i] = oi;
@@ -751,13 +1436,17 @@ struct traits<dyn_array<T>> {
             for (size_t i = 0; i < len; ++i) {
                 size_t start_rel = offs[i], end_rel = offs[i + 1];
                 if (end_rel < start_rel) {
-                    if (e) e->message = "dyn_array: off order";
+                    if (e)
+                        e->set(ErrorCode::bad_offset, "dyn_array: off order",
+                               32 + 32 * i);
                     return false;
                 }
                 size_t start_abs = base + start_rel, span = end_rel - start_rel;
-                if (!traits<T>::decode(BytesSpan(in.data() + start_abs, span),
-                                       out[i], e))
+                if (!traits<T>::template decode<P>(
+                        BytesSpan(in.data() + start_abs, span), out[i], e)) {
+                    if (e) e->nest(uint32_t(i), start_abs);
                     return false;
+                }
             }
             return true;
         }
@@ -812,15 +1501,45 @@ struct traits<tuple<Ts...>> {
     }
 
     // ----- decode -----
-
-    static bool decode(BytesSpan in, typename value_of<tuple<Ts...>>::type& out,
-                       Error* e = nullptr) {
+    // Out is value_of<tuple<Ts...>>::type or a std::tuple of references to
+    // existing fields (named structs decode through their tie())
+    template <class P = checked, class Out>
+    static bool decode(BytesSpan in, Out& out, Error* e = nullptr) {
+        if constexpr (!P::verify) {
+            // One pass over the head: static fields inline, dynamic ones
+            // through their offset (relative to the tuple start)
+            size_t head = 0;
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                (([&] {
+                     using Sch =
+                         typename std::tuple_element<I,
+                                                     std::tuple<Ts...>>::type;
+                     if constexpr (traits<Sch>::is_dynamic) {
+                         const size_t off = load_size_word(in.data() + head);
+                         traits<Sch>::template decode<P>(
+                             BytesSpan(in.data() + off, in.size() - off),
+                             std::get<I>(out), e);
+                         head += 32;
+                     } else {
+                         constexpr size_t bytes = 32 * traits<Sch>::head_words;
+                         traits<Sch>::template decode<P>(
+                             BytesSpan(in.data() + head, bytes),
+                             std::get<I>(out), e);
+                         head += bytes;
+                     }
+                 }()),
+                 ...);
+            }(std::make_index_sequence<sizeof...(Ts)>{});
+            return true;
+        }
+        detail::DepthScope depth;
+        if (!depth.enter(e)) return false;
         // -------- static tuple: heads inline, no offsets
         if constexpr (!is_dynamic) {
             constexpr size_t total_words = (traits<Ts>::head_words + ... + 0);
             const size_t need = 32 * total_words;
             if (in.size() < need) {
-                if (e) e->message = "tuple: head short";
+                if (e) e->set(ErrorCode::short_input, "tuple: head short");
                 return false;
             }
 
@@ -834,9 +1553,12 @@ struct traits<tuple<Ts...>> {
                          typename std::tuple_element<I,
                                                      std::tuple<Ts...>>::type;
                      constexpr size_t words = traits<Sch>::head_words;
-                     ok = ok && traits<Sch>::decode(
-                                    BytesSpan(in.data() + off, 32 * words),
-                                    std::get<I>(out), e);
+                     if (ok && !traits<Sch>::template decode<P>(
+                                   BytesSpan(in.data() + off, 32 * words),
+                                   std::get<I>(out), e)) {
+                         ok = false;
+                         if (e) e->nest(uint32_t(I), off);
+                     }
                      off += 32 * words;
                  }()),
                  ...);
@@ -848,7 +1570,7 @@ struct traits<tuple<Ts...>> {
         // -------- dynamic tuple: local head of size 32 * head_words_static
         const size_t need = 32 * head_words_static;
         if (in.size() < need) {
-            if (e) e->message = "tuple(dyn): head short";
+            if (e) e->set(ErrorCode::short_input, "tuple(dyn): head short");
             return false;
         }
 
@@ -865,17 +1587,17 @@ struct traits<tuple<Ts...>> {
             (([&] {
                  using Sch =
                      typename std::tuple_element<I, std::tuple<Ts...>>::type;
+                 if (!ok) return;  // keep the first failure
                  if constexpr (traits<Sch>::is_dynamic) {
-                     // Read local offset
-                     const size_t off = static_cast<size_t>(
-                         read_u256_big(in.data() + 32 * head_cursor)
-                             .convert_to<unsigned long long>());
-
-                     // Basic sanity: tail starts at or after head; and within
-                     // the buffer.
-                     if (off < need || off > in.size()) {
+                     // Read local offset. Basic sanity: tail starts at or
+                     // after head; and within the buffer.
+                     size_t off = 0;
+                     if (!read_size_word(in.data() + 32 * head_cursor, off) ||
+                         off < need || off > in.size()) {
                          ok = false;
-                         if (e) e->message = "tuple(dyn): bad off";
+                         if (e)
+                             e->set(ErrorCode::bad_offset,
+                                    "tuple(dyn): bad off", 32 * head_cursor);
                          return;
                      }
                      dyn_off[I] = off;
@@ -899,32 +1621,43 @@ struct traits<tuple<Ts...>> {
             (([&] {
                  using Sch =
                      typename std::tuple_element<I, std::tuple<Ts...>>::type;
-
+                 if (!ok) return;  // keep the first failure
                  if constexpr (traits<Sch>::is_dynamic) {
                      const size_t off = dyn_off[I];
                      const size_t span =
                          (off <= in.size()) ? (in.size() - off) : 0;
                      if (span == 0) {
                          ok = false;
-                         if (e) e->message = "tuple(dyn): tail short";
+                         if (e)
+                             e->set(ErrorCode::short_input,
+                                    "tuple(dyn): tail short", 32 * head_cursor);
                          return;
                      }
-                     ok = ok &&
-                          traits<Sch>::decode(BytesSpan(in.data() + off, span),
-                                              std::get<I>(out), e);
+                     if (ok && !traits<Sch>::template decode<P>(
+                                   BytesSpan(in.data() + off, span),
+                                   std::get<I>(out), e)) {
+                         ok = false;
+                         if (e) e->nest(uint32_t(I), off);
+                     }
                      head_cursor += 1;
                  } else {
                      constexpr size_t words = traits<Sch>::head_words;
                      const size_t bytes = 32 * words;
                      if (32 * head_cursor + bytes > in.size()) {
                          ok = false;
-                         if (e) e->message = "tuple(dyn): static overrun";
+                         if (e)
+                             e->set(ErrorCode::bad_offset,
+                                    "tuple(dyn): static overrun",
+                                    32 * head_cursor);
                          return;
                      }
-                     ok = ok &&
-                          traits<Sch>::decode(
-                              BytesSpan(in.data() + 32 * head_cursor, bytes),
-                              std::get<I>(out), e);
+                     if (ok && !traits<Sch>::template decode<P>(
+                                   BytesSpan(in.data() + 32 * head_cursor,
+                                             bytes),
+                                   std::get<I>(out), e)) {
+                         ok = false;
+                         if (e) e->nest(uint32_t(I), 32 * head_cursor);
+                     }
                      head_cursor += words;
                  }
              }()),
@@ -1058,7 +1791,7 @@ inline bool encode_into(uint8_t* out, size_t out_cap, const V& value,
                         Error* e = nullptr) {
     const size_t need = encoded_size<Schema>(value);
     if (out_cap < need) {
-        if (e) e->message = "encode: buffer too small";
+        if (e) e->set(ErrorCode::buffer_too_small, "encode: buffer too small");
         return false;
     }
 
@@ -1119,7 +1852,9 @@ inline bool encode_call_into(uint8_t* out, size_t out_cap,
     static_assert(sizeof...(Schemas) == sizeof...(Vs), "arity mismatch");
     const size_t need = encoded_size_call<Schemas...>(args);
     if (out_cap < need) {
-        if (e) e->message = "encode_call: buffer too small";
+        if (e)
+            e->set(ErrorCode::buffer_too_small,
+                   "encode_call: buffer too small");
         return false;
     }
 
@@ -1164,6 +1899,73 @@ inline bool encode_call_into(uint8_t* out, size_t out_cap,
     return true;
 }
 
+// Decode argument i whose head sits at in[head]; advances head
+template <class S, class P = checked, class Out>
+inline bool decode_call_arg(BytesSpan in, size_t i, size_t& head, Out& out,
+                            Error* e) {
+    if constexpr (traits<S>::is_dynamic) {
+        size_t off = 0;
+        if constexpr (P::verify) {
+            if (!read_size_word(in.data() + head, off) || off > in.size()) {
+                if (e) e->set(ErrorCode::bad_offset, "call: bad off", head);
+                return false;
+            }
+        } else {
+            off = load_size_word(in.data() + head);
+        }
+        head += 32;
+        if (!traits<S>::template decode<P>(
+                BytesSpan(in.data() + off, in.size() - off), out, e)) {
+            if (e) e->nest(uint32_t(i), off);
+            return false;
+        }
+    } else {
+        const size_t n = 32 * traits<S>::head_words;
+        const BytesSpan s(in.data() + head, n);
+        if (!traits<S>::template decode<P>(s, out, e)) {
+            if (e) e->nest(uint32_t(i), head);
+            return false;
+        }
+        head += n;
+    }
+    return true;
+}
+
+// Inverse of encode_call_into without the selector: `in` starts at the first
+// argument head and refs is a tuple of lvalue references to the outputs.
+// decode_args_into<P, Schemas...> picks the decode policy (it goes first, as
+// the schema pack must be last); decode_args_into<Schemas...> is checked.
+template <class P, class... Schemas, class Refs,
+          std::enable_if_t<is_decode_policy<P>::value, int> = 0>
+inline bool decode_args_into(BytesSpan in, const Refs& refs,
+                             Error* e = nullptr) {
+    static_assert(sizeof...(Schemas) == std::tuple_size<Refs>::value,
+                  "arity mismatch");
+    constexpr size_t head_words_total =
+        ((traits<Schemas>::is_dynamic ? 1 : traits<Schemas>::head_words) + ... +
+         0);
+    if constexpr (P::verify) {
+        if (in.size() < 32 * head_words_total) {
+            if (e) e->set(ErrorCode::short_input, "call: head short");
+            return false;
+        }
+    }
+    size_t head = 0;
+    bool ok = true;
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        ((ok = ok && decode_call_arg<Schemas, P>(in, I, head,
+                                                 std::get<I>(refs), e)),
+         ...);
+    }(std::index_sequence_for<Schemas...>{});
+    return ok;
+}
+template <class... Schemas, class Refs,
+          std::enable_if_t<!(is_decode_policy<Schemas>::value || ...), int> = 0>
+inline bool decode_args_into(BytesSpan in, const Refs& refs,
+                             Error* e = nullptr) {
+    return decode_args_into<checked, Schemas...>(in, refs, e);
+}
+
 // ----------------- HFT Optimized Call Encoding (Zero-allocation)
 // -----------------
 
@@ -1219,31 +2021,54 @@ inline bool encode_call_into_hft(HFTBuffer<>& buf,
 }
 
 // ----------------- result decoder -----------------
-template <class Schema, class Out>
+// P is the decode policy: decode_from<Schema, abi::trusted>(in, out) for
+// input from an encoder we control
+template <class Schema, class P = checked, class Out>
 inline bool decode_from(BytesSpan in, Out& out, Error* e = nullptr) {
     if constexpr (needs_top_ptr<Schema>::value) {
-        if (in.size() < 32) {
-            if (e) e->message = "top: short";
-            return false;
+        size_t off = 0;
+        if constexpr (P::verify) {
+            if (in.size() < 32) {
+                if (e) e->set(ErrorCode::short_input, "top: short");
+                return false;
+            }
+            if (!read_size_word(in.data(), off) || off > in.size()) {
+                if (e) e->set(ErrorCode::bad_offset, "top: bad off");
+                return false;
+            }
+        } else {
+            off = load_size_word(in.data());
         }
-        size_t off = static_cast<size_t>(
-            read_u256_big(in.data()).convert_to<unsigned long long>());
-        if (off > in.size()) {
-            if (e) e->message = "top: bad off";
+        if (!traits<Schema>::template decode<P>(
+                BytesSpan(in.data() + off, in.size() - off), out, e)) {
+            if (e) e->shift(off);
             return false;
         }
-        return traits<Schema>::decode(
-            BytesSpan(in.data() + off, in.size() - off), out, e);
+        return true;
     } else {
-        return traits<Schema>::decode(in, out, e);
+        return traits<Schema>::template decode<P>(in, out, e);
     }
 }
 
+// Same, enforcing limits on everything the decode allocates (bytes and
+// string payloads, array storage, nesting depth). Exceeding one fails with
+// ErrorCode::limit_exceeded before the allocation is made.
+template <class Schema, class Out>
+inline bool decode_from(BytesSpan in, Out& out, const DecodeLimits& limits,
+                        Error* e = nullptr) {
+    detail::BudgetScope scope(limits);
+    return decode_from<Schema>(in, out, e);
+}
+
 // ----------------- Fn wrapper (C++17 selector type) -----------------
 // Provide a Selector type with: static constexpr std::array<uint8_t,4> value;
 template <class Selector, class RetSchema, class... ArgSchemas>
 struct Fn {
+    using selector = Selector;
+    using return_schema = RetSchema;
     using return_t = typename value_of<RetSchema>::type;
+    using pmr_return_t = pmr_value_t<RetSchema>;
+    using args_schema = tuple<ArgSchemas...>;
 
     // Function call encoding (input: arguments, output: encoded call data)
     template <class... Vs>
@@ -1259,6 +2084,33 @@ struct Fn {
                                                e);
     }
 
+    // Calldata as "0x"-prefixed lowercase hex for eth_call params (no
+    // terminator). The binary encoding is built in the back half of out and
+    // expanded in place, so out needs encoded_hex_size(vs...) chars.
+    template <class... Vs>
+    static size_t encoded_hex_size(const Vs&... vs) {
+        return 2 + 2 * encoded_size(vs...);
+    }
+    template <class... Vs>
+    static bool encode_call_hex(char* out, size_t cap, const Vs&... vs,
+                                Error* e = nullptr) {
+        auto tup = std::forward_as_tuple(vs...);
+        const size_t n = encoded_size_call<ArgSchemas...>(tup);
+        if (cap < 2 + 2 * n) {
+            if (e)
+                e->set(ErrorCode::buffer_too_small,
+                       "encode_call_hex: buffer too small");
+            return false;
+        }
+        uint8_t* bin = reinterpret_cast<uint8_t*>(out + 2 + n);
+        if (!encode_call_into<ArgSchemas...>(bin, n, Selector::value, tup, e))
+            return false;
+        out[0] = '0';
+        out[1] = 'x';
+        hex_encode(bin, n, out + 2);
+        return true;
+    }
+
     // HFT-optimized encoding using thread-local buffer
     template <class... Vs>
     static uint8_t* encode_call_hft(const Vs&... vs) {
@@ -1271,9 +2123,50 @@ struct Fn {
         return hft_buffer.data;
     }
 
-    // Return value decoding (input: response data, output: decoded result)
-    static bool decode_result(BytesSpan in, return_t& out, Error* e = nullptr) {
-        return decode_from<RetSchema>(in, out, e);
+    // Calldata decoding (input: selector + encoded arguments, output: one
+    // lvalue per argument). Fails if the selector does not match.
+    // The selector is compared under every policy (it says which function
+    // the calldata is for); trusted only drops the length guard.
+    using args_t = std::tuple<typename value_of<ArgSchemas>::type...>;
+    template <class P = checked>
+    static bool decode_call(BytesSpan in,
+                            typename value_of<ArgSchemas>::type&... outs,
+                            Error* e = nullptr) {
+        if ((P::verify && in.size() < 4) ||
+            std::memcmp(in.data(), Selector::value.data(), 4) != 0) {
+            if (e)
+                e->set(ErrorCode::selector_mismatch, "call: selector mismatch");
+            return false;
+        }
+        if (!decode_args_into<P, ArgSchemas...>(
+                BytesSpan(in.data() + 4, in.size() - 4), std::tie(outs...),
+                e)) {
+            if (e) e->shift(4);  // offsets count the selector
+            return false;
+        }
+        return true;
+    }
+    template <class P = checked>
+    static bool decode_call(BytesSpan in, args_t& out, Error* e = nullptr) {
+        return std::apply(
+            [&](auto&... outs) { return decode_call<P>(in, outs..., e); },
+            out);
+    }
+
+    // Return value decoding (input: response data, output: decoded result
+    // as return_t, or as pmr_return_t to allocate from out's resource)
+    template <class Out>
+    using if_result_t =
+        std::enable_if_t<std::is_same_v<Out, return_t> ||
+                         std::is_same_v<Out, pmr_return_t>>;
+    template <class P = checked, class Out, class = if_result_t<Out>>
+    static bool decode_result(BytesSpan in, Out& out, Error* e = nullptr) {
+        return decode_from<RetSchema, P>(in, out, e);
+    }
+    template <class Out, class = if_result_t<Out>>
+    static bool decode_result(BytesSpan in, Out& out,
+                              const DecodeLimits& limits, Error* e = nullptr) {
+        return decode_from<RetSchema>(in, out, limits, e);
     }
 };
 
@@ -1303,15 +2196,12 @@ struct Event {
         return encode_into<data_schema>(out, cap, std::make_tuple(vs...), e);
     }
 
-    // Named struct decoding (non-indexed parameters only)
+    // Named struct decoding (non-indexed parameters only), straight into
+    // the fields of out
     static bool decode_data(BytesSpan in, NamedStruct& out,
                             Error* e = nullptr) {
-        data_tuple_type tuple_data;
-        if (!decode_from<data_schema>(in, tuple_data, e)) {
-            return false;
-        }
-        out = NamedStruct::from_tuple(tuple_data);
-        return true;
+        auto fields = NamedStruct::tie(out);
+        return decode_from<data_schema>(in, fields, e);
     }
 
     // Utility to check if a topic matches this event
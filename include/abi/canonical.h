@@ -0,0 +1,375 @@
+#pragma once
+#include "abi.h"
+
+// Strict canonical-encoding check: abi::validate_canonical<Schema>(in)
+// accepts a payload only if it is byte for byte what encode_into (or any
+// compliant encoder) produces for the value it holds, so equal values have
+// equal bytes and a payload can be deduplicated or content-hashed as is.
+// On top of what decode checks, it requires
+//   - zero high bytes in uintN and address words, and in bytes/string
+//     padding
+//   - intN words sign-extended from bit N-1
+//   - bools equal to 0 or 1
+//   - every offset pointing exactly at the end of the previous tail (first
+//     tail right after the head), with no gaps or sharing
+//   - no bytes after the value
+// Nothing is decoded or allocated. Word checks compare all 32 bytes at once
+// (AVX2, or two SSE2 compares).
+
+namespace abi {
+
+namespace canonical_detail {
+
+// Bit i set when byte i of the word at p equals fill
+inline uint32_t byte_mask(const uint8_t* p, uint8_t fill) {
+#if defined(__AVX2__)
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(v, _mm256_set1_epi8(static_cast<char>(fill)))));
+#elif defined(__SSE2__)
+    const __m128i f = _mm_set1_epi8(static_cast<char>(fill));
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(lo, f))) |
+           (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(hi, f)))
+            << 16);
+#else
+    uint32_t m = 0;
+    for (int i = 0; i < 32; ++i) m |= uint32_t(p[i] == fill) << i;
+    return m;
+#endif
+}
+
+// Bytes [from, to) of the word at p all equal fill
+inline bool bytes_are(const uint8_t* p, size_t from, size_t to, uint8_t fill) {
+    const uint32_t want =
+        static_cast<uint32_t>((uint64_t(1) << to) - (uint64_t(1) << from));
+    return (byte_mask(p, fill) & want) == want;
+}
+
+// read_size_word with the zero check done as one word compare
+inline bool size_word(const uint8_t* p, size_t& out) {
+    if (!bytes_are(p, 0, 24, 0)) return false;
+    out = load_size_word(p);
+    return true;
+}
+
+// Shared by bytes and string: length word, payload, zero padding
+inline bool check_payload(BytesSpan in, size_t& used, Error* e,
+                          const char* short_msg, const char* len_msg,
+                          const char* pad_msg) {
+    size_t len = 0;
+    if (in.size() < 32) {
+        if (e) e->set_static(ErrorCode::short_input, short_msg);
+        return false;
+    }
+    if (!size_word(in.data(), len) || len > in.size() - 32) {
+        if (e) e->set_static(ErrorCode::out_of_range, len_msg);
+        return false;
+    }
+    const size_t padded = pad32(len);
+    if (padded > in.size() - 32) {
+        if (e) e->set_static(ErrorCode::short_input, short_msg);
+        return false;
+    }
+    if (len != padded && !bytes_are(in.data() + padded, len % 32, 32, 0)) {
+        if (e) e->set_static(ErrorCode::non_canonical, pad_msg, 32 + len);
+        return false;
+    }
+    used = 32 + padded;
+    return true;
+}
+
+}  // namespace canonical_detail
+
+// Per-schema checks; `in` starts at the encoding of the value, exactly as
+// for traits<Schema>::decode. used receives the bytes the value occupies
+// (head and tail).
+template <class Schema>
+struct canonical_traits;
+
+template <>
+struct canonical_traits<bool_t> {
+    static bool check(BytesSpan in, size_t& used, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "bool: short");
+            return false;
+        }
+        if (!canonical_detail::bytes_are(in.data(), 0, 31, 0) ||
+            in.data()[31] > 1) {
+            if (e) e->set(ErrorCode::non_canonical, "bool: not 0 or 1");
+            return false;
+        }
+        used = 32;
+        return true;
+    }
+};
+
+template <>
+struct canonical_traits<address20> {
+    static bool check(BytesSpan in, size_t& used, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "address: short");
+            return false;
+        }
+        if (!canonical_detail::bytes_are(in.data(), 0, 12, 0)) {
+            if (e)
+                e->set(ErrorCode::non_canonical, "address: dirty high bytes");
+            return false;
+        }
+        used = 32;
+        return true;
+    }
+};
+
+template <int N>
+struct canonical_traits<uint_t<N>> {
+    static bool check(BytesSpan in, size_t& used, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "uintN: short");
+            return false;
+        }
+        if constexpr (N < 256) {
+            if (!canonical_detail::bytes_are(in.data(), 0, 32 - N / 8, 0)) {
+                if (e) e->set(ErrorCode::non_canonical, "uintN: out of range");
+                return false;
+            }
+        }
+        used = 32;
+        return true;
+    }
+};
+
+template <int N>
+struct canonical_traits<int_t<N>> {
+    static bool check(BytesSpan in, size_t& used, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "intN: short");
+            return false;
+        }
+        if constexpr (N < 256) {
+            constexpr size_t pad = 32 - N / 8;
+            const uint8_t fill = (in.data()[pad] & 0x80) ? 0xff : 0x00;
+            if (!canonical_detail::bytes_are(in.data(), 0, pad, fill)) {
+                if (e)
+                    e->set(ErrorCode::non_canonical,
+                           "intN: bad sign extension");
+                return false;
+            }
+        }
+        used = 32;
+        return true;
+    }
+};
+
+template <>
+struct canonical_traits<bytes> {
+    static bool check(BytesSpan in, size_t& used, Error* e) {
+        return canonical_detail::check_payload(in, used, e, "bytes: short",
+                                               "bytes: len out of range",
+                                               "bytes: dirty padding");
+    }
+};
+
+template <>
+struct canonical_traits<string_t> {
+    static bool check(BytesSpan in, size_t& used, Error* e) {
+        return canonical_detail::check_payload(in, used, e, "string: short",
+                                               "string: len out of range",
+                                               "string: dirty padding");
+    }
+};
+
+namespace canonical_detail {
+
+// n elements laid out from the start of in: static ones inline, dynamic
+// ones as offsets relative to in, each of which must point exactly where
+// the previous tail ended
+template <class T>
+inline bool check_elems(BytesSpan in, size_t n, size_t& used, Error* e,
+                        const char* short_msg, const char* off_msg) {
+    constexpr bool dyn = traits<T>::is_dynamic;
+    constexpr size_t stride = dyn ? 32 : 32 * traits<T>::head_words;
+    if (n > in.size() / stride) {
+        if (e) e->set_static(ErrorCode::short_input, short_msg);
+        return false;
+    }
+    size_t end = n * stride;
+    for (size_t i = 0; i < n; ++i) {
+        size_t start = i * stride, elem = 0;
+        if constexpr (dyn) {
+            size_t off = 0;
+            if (!size_word(in.data() + start, off) || off != end) {
+                if (e) e->set_static(ErrorCode::non_canonical, off_msg, start);
+                return false;
+            }
+            start = end;
+        }
+        if (!canonical_traits<T>::check(
+                BytesSpan(in.data() + start, dyn ? in.size() - start : stride),
+                elem, e)) {
+            if (e) e->nest(uint32_t(i), start);
+            return false;
+        }
+        if constexpr (dyn) end += elem;
+    }
+    used = end;
+    return true;
+}
+
+}  // namespace canonical_detail
+
+template <class T, size_t N>
+struct canonical_traits<static_array<T, N>> {
+    static bool check(BytesSpan in, size_t& used, Error* e) {
+        return canonical_detail::check_elems<T>(
+            in, N, used, e, "static_array: short",
+            "static_array: non-canonical offset");
+    }
+};
+
+template <class T>
+struct canonical_traits<dyn_array<T>> {
+    static bool check(BytesSpan in, size_t& used, Error* e) {
+        size_t len = 0;
+        if (in.size() < 32 || !canonical_detail::size_word(in.data(), len)) {
+            if (e) e->set(ErrorCode::short_input, "dyn_array: short");
+            return false;
+        }
+        if (!canonical_detail::check_elems<T>(
+                BytesSpan(in.data() + 32, in.size() - 32), len, used, e,
+                traits<T>::is_dynamic ? "dyn_array: offs short"
+                                      : "dyn_array: inline short",
+                "dyn_array: non-canonical offset")) {
+            if (e) e->shift(32);
+            return false;
+        }
+        used += 32;
+        return true;
+    }
+};
+
+template <class... Ts>
+struct canonical_traits<tuple<Ts...>> {
+    static bool check(BytesSpan in, size_t& used, Error* e) {
+        constexpr size_t need = 32 * traits<tuple<Ts...>>::head_words_static;
+        if (in.size() < need) {
+            if (e) e->set(ErrorCode::short_input, "tuple: head short");
+            return false;
+        }
+        size_t head = 0, end = need;
+        bool ok = true;
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((ok = ok && field<Ts>(in, head, end, I, e)), ...);
+        }(std::index_sequence_for<Ts...>{});
+        used = end;
+        return ok;
+    }
+
+private:
+    template <class T>
+    static bool field(BytesSpan in, size_t& head, size_t& end, size_t i,
+                      Error* e) {
+        size_t elem = 0;
+        if constexpr (traits<T>::is_dynamic) {
+            size_t off = 0;
+            if (!canonical_detail::size_word(in.data() + head, off) ||
+                off != end) {
+                if (e)
+                    e->set(ErrorCode::non_canonical,
+                           "tuple: non-canonical offset", head);
+                return false;
+            }
+            head += 32;
+            if (!canonical_traits<T>::check(
+                    BytesSpan(in.data() + off, in.size() - off), elem, e)) {
+                if (e) e->nest(uint32_t(i), off);
+                return false;
+            }
+            end += elem;
+        } else {
+            const size_t n = 32 * traits<T>::head_words;
+            if (!canonical_traits<T>::check(BytesSpan(in.data() + head, n),
+                                            elem, e)) {
+                if (e) e->nest(uint32_t(i), head);
+                return false;
+            }
+            head += n;
+        }
+        return true;
+    }
+};
+
+// Named structs check their underlying tuple schema
+template <class Schema>
+struct canonical_traits {
+    static bool check(BytesSpan in, size_t& used, Error* e) {
+        return canonical_traits<typename Schema::schema>::check(in, used, e);
+    }
+};
+
+namespace canonical_detail {
+
+// Schema at in[start..] with nothing after it
+template <class Schema>
+inline bool check_exact(BytesSpan in, size_t start, Error* e) {
+    size_t used = 0;
+    if (!canonical_traits<Schema>::check(
+            BytesSpan(in.data() + start, in.size() - start), used, e)) {
+        if (e) e->shift(start);
+        return false;
+    }
+    if (start + used != in.size()) {
+        if (e)
+            e->set(ErrorCode::non_canonical, "canonical: trailing bytes",
+                   start + used);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace canonical_detail
+
+// True when in is the canonical encoding of a Schema value as encode_into
+// lays it out (a dynamic value behind a top offset of 32).
+// Decodable but non-canonical input fails with ErrorCode::non_canonical;
+// input decode would reject fails with the usual codes.
+template <class Schema>
+inline bool validate_canonical(BytesSpan in, Error* e = nullptr) {
+    if constexpr (traits<Schema>::is_dynamic) {
+        size_t off = 0;
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "top: short");
+            return false;
+        }
+        if (!canonical_detail::size_word(in.data(), off) || off != 32) {
+            if (e)
+                e->set(ErrorCode::non_canonical, "top: non-canonical offset");
+            return false;
+        }
+        return canonical_detail::check_exact<Schema>(in, 32, e);
+    } else {
+        return canonical_detail::check_exact<Schema>(in, 0, e);
+    }
+}
+
+// Argument list without selector, as taken by decode_args_into
+template <class... Schemas>
+inline bool validate_canonical_args(BytesSpan in, Error* e = nullptr) {
+    return canonical_detail::check_exact<tuple<Schemas...>>(in, 0, e);
+}
+
+// Full calldata for a generated Fn<>: its selector, then canonical
+// arguments
+template <class F>
+inline bool validate_canonical_call(BytesSpan in, Error* e = nullptr) {
+    if (in.size() < 4 ||
+        std::memcmp(in.data(), F::selector::value.data(), 4) != 0) {
+        if (e) e->set(ErrorCode::selector_mismatch, "call: selector mismatch");
+        return false;
+    }
+    return canonical_detail::check_exact<typename F::args_schema>(in, 4, e);
+}
+
+}  // namespace abi
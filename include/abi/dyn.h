@@ -0,0 +1,1120 @@
+#pragma once
+#include <cctype>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <variant>
+
+#include "abi.h"
+#include "keccak.h"
+
+// Runtime ABI support: type descriptors parsed from ABI JSON and a codec over
+// dyn::Value that produces the same bytes as the compile-time traits<> path.
+// Use it for contracts that are not in protocols.h.
+
+namespace abi {
+namespace dyn {
+
+// ----------------- minimal JSON reader -----------------
+namespace json {
+
+struct Node {
+    enum class Type : uint8_t { Null, Bool, Number, String, Array, Object };
+    Type type{Type::Null};
+    bool boolean{false};
+    std::string text;  // string contents, or the literal number text
+    std::vector<Node> items;
+    std::vector<std::pair<std::string, Node>> fields;
+
+    const Node* get(std::string_view key) const {
+        for (const auto& f : fields)
+            if (f.first == key) return &f.second;
+        return nullptr;
+    }
+    std::string_view str(std::string_view key,
+                         std::string_view fallback = {}) const {
+        const Node* n = get(key);
+        return (n && n->type == Type::String) ? std::string_view(n->text)
+                                              : fallback;
+    }
+};
+
+class Parser {
+public:
+    explicit Parser(std::string_view s) : s_(s) {
+    }
+
+    bool parse(Node& out, Error* e) {
+        if (!value(out, 0)) return fail(e);
+        ws();
+        if (pos_ != s_.size()) {
+            err_ = "json: trailing characters";
+            return fail(e);
+        }
+        return true;
+    }
+
+private:
+    std::string_view s_;
+    size_t pos_{0};
+    const char* err_{"json: syntax error"};
+
+    bool fail(Error* e) {
+        if (e) {
+            e->set_static(ErrorCode::invalid_text, err_, pos_);
+        }
+        return false;
+    }
+    void ws() {
+        while (pos_ < s_.size() && (s_[pos_] == ' ' || s_[pos_] == '\n' ||
+                                    s_[pos_] == '\r' || s_[pos_] == '\t'))
+            ++pos_;
+    }
+    bool lit(std::string_view w) {
+        if (s_.substr(pos_, w.size()) != w) return false;
+        pos_ += w.size();
+        return true;
+    }
+    bool value(Node& n, int depth) {
+        if (depth > 64) {
+            err_ = "json: too deep";
+            return false;
+        }
+        ws();
+        if (pos_ >= s_.size()) return false;
+        const char c = s_[pos_];
+        if (c == '{') return object(n, depth);
+        if (c == '[') return array(n, depth);
+        if (c == '"') {
+            n.type = Node::Type::String;
+            return string(n.text);
+        }
+        if (lit("true") || lit("false")) {
+            n.type = Node::Type::Bool;
+            n.boolean = c == 't';
+            return true;
+        }
+        if (lit("null")) {
+            n.type = Node::Type::Null;
+            return true;
+        }
+        const size_t start = pos_;
+        while (pos_ < s_.size() &&
+               (std::isdigit(static_cast<unsigned char>(s_[pos_])) ||
+                s_[pos_] == '-' || s_[pos_] == '+' || s_[pos_] == '.' ||
+                s_[pos_] == 'e' || s_[pos_] == 'E'))
+            ++pos_;
+        if (pos_ == start) return false;
+        n.type = Node::Type::Number;
+        n.text.assign(s_.substr(start, pos_ - start));
+        return true;
+    }
+    bool object(Node& n, int depth) {
+        n.type = Node::Type::Object;
+        ++pos_;
+        ws();
+        if (pos_ < s_.size() && s_[pos_] == '}') return ++pos_, true;
+        for (;;) {
+            ws();
+            std::string key;
+            if (pos_ >= s_.size() || s_[pos_] != '"' || !string(key))
+                return false;
+            ws();
+            if (pos_ >= s_.size() || s_[pos_] != ':') return false;
+            ++pos_;
+            n.fields.emplace_back(std::move(key), Node{});
+            if (!value(n.fields.back().second, depth + 1)) return false;
+            ws();
+            if (pos_ < s_.size() && s_[pos_] == ',') {
+                ++pos_;
+                continue;
+            }
+            if (pos_ < s_.size() && s_[pos_] == '}') return ++pos_, true;
+            return false;
+        }
+    }
+    bool array(Node& n, int depth) {
+        n.type = Node::Type::Array;
+        ++pos_;
+        ws();
+        if (pos_ < s_.size() && s_[pos_] == ']') return ++pos_, true;
+        for (;;) {
+            n.items.emplace_back();
+            if (!value(n.items.back(), depth + 1)) return false;
+            ws();
+            if (pos_ < s_.size() && s_[pos_] == ',') {
+                ++pos_;
+                continue;
+            }
+            if (pos_ < s_.size() && s_[pos_] == ']') return ++pos_, true;
+            return false;
+        }
+    }
+    bool string(std::string& out) {
+        ++pos_;  // opening quote
+        while (pos_ < s_.size()) {
+            const char c = s_[pos_++];
+            if (c == '"') return true;
+            if (c != '\\') {
+                out.push_back(c);
+                continue;
+            }
+            if (pos_ >= s_.size()) break;
+            const char esc = s_[pos_++];
+            switch (esc) {
+                case 'n': out.push_back('\n'); break;
+                case 't': out.push_back('\t'); break;
+                case 'r': out.push_back('\r'); break;
+                case 'b': out.push_back('\b'); break;
+                case 'f': out.push_back('\f'); break;
+                case 'u': {
+                    if (pos_ + 4 > s_.size()) return false;
+                    unsigned cp = 0;
+                    for (int i = 0; i < 4; ++i) {
+                        const char h = s_[pos_++];
+                        cp <<= 4;
+                        if (h >= '0' && h <= '9') cp |= h - '0';
+                        else if ((h | 32) >= 'a' && (h | 32) <= 'f')
+                            cp |= 10 + ((h | 32) - 'a');
+                        else return false;
+                    }
+                    // ABI JSON is ASCII in practice; emit UTF-8 for the BMP
+                    if (cp < 0x80) {
+                        out.push_back(static_cast<char>(cp));
+                    } else if (cp < 0x800) {
+                        out.push_back(static_cast<char>(0xc0 | (cp >> 6)));
+                        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+                    } else {
+                        out.push_back(static_cast<char>(0xe0 | (cp >> 12)));
+                        out.push_back(
+                            static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+                        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+                    }
+                    break;
+                }
+                default: out.push_back(esc); break;
+            }
+        }
+        err_ = "json: unterminated string";
+        return false;
+    }
+};
+
+inline bool parse(std::string_view text, Node& out, Error* e = nullptr) {
+    out = Node{};
+    return Parser(text).parse(out, e);
+}
+
+}  // namespace json
+
+// ----------------- type descriptors -----------------
+enum class Kind : uint8_t {
+    Uint,
+    Int,
+    Bool,
+    Address,
+    FixedBytes,  // bytes1..bytes32
+    Bytes,
+    String,
+    StaticArray,
+    DynArray,
+    Tuple
+};
+
+struct TypeDesc {
+    Kind kind{Kind::Uint};
+    uint16_t bits{256};              // Uint/Int width; FixedBytes byte count
+    size_t length{0};                // StaticArray length
+    std::vector<TypeDesc> children;  // array element or tuple components
+    std::vector<std::string> names;  // tuple component names (may be empty)
+
+    // Derived layout, filled by finalize()
+    bool dynamic{false};
+    size_t head_words{1};  // words used inline when static
+
+    bool is_dynamic() const {
+        return dynamic;
+    }
+
+    void finalize() {
+        switch (kind) {
+            case Kind::Bytes:
+            case Kind::String:
+            case Kind::DynArray:
+                dynamic = true;
+                head_words = 1;
+                break;
+            case Kind::StaticArray:
+                dynamic = children[0].dynamic;
+                head_words = dynamic ? 1 : length * children[0].head_words;
+                break;
+            case Kind::Tuple: {
+                dynamic = false;
+                size_t words = 0;
+                for (const auto& c : children) {
+                    dynamic = dynamic || c.dynamic;
+                    words += c.head_words;
+                }
+                head_words = dynamic ? 1 : words;
+                break;
+            }
+            default:
+                dynamic = false;
+                head_words = 1;
+                break;
+        }
+    }
+
+    // Canonical type string as used in signatures, e.g. "(address,bytes)[]"
+    std::string canonical() const {
+        switch (kind) {
+            case Kind::Uint: return "uint" + std::to_string(bits);
+            case Kind::Int: return "int" + std::to_string(bits);
+            case Kind::Bool: return "bool";
+            case Kind::Address: return "address";
+            case Kind::FixedBytes: return "bytes" + std::to_string(bits);
+            case Kind::Bytes: return "bytes";
+            case Kind::String: return "string";
+            case Kind::StaticArray:
+                return children[0].canonical() + "[" + std::to_string(length) +
+                       "]";
+            case Kind::DynArray: return children[0].canonical() + "[]";
+            case Kind::Tuple: {
+                std::string s = "(";
+                for (size_t i = 0; i < children.size(); ++i) {
+                    if (i) s += ',';
+                    s += children[i].canonical();
+                }
+                return s + ")";
+            }
+        }
+        return {};
+    }
+
+    // Parse a Solidity type string: "uint24", "address[]", "(int24,uint128)[2]"
+    static bool parse(std::string_view type, TypeDesc& out,
+                      Error* e = nullptr) {
+        out = TypeDesc{};
+        if (!parse_impl(type, out)) {
+            if (e)
+                e->set(ErrorCode::other,
+                       "dyn: bad type '" + std::string(type) + "'");
+            return false;
+        }
+        return true;
+    }
+
+    // Build from an ABI JSON parameter ({"type": ..., "components": [...]})
+    static bool from_json(const json::Node& param, TypeDesc& out,
+                          Error* e = nullptr) {
+        std::string_view type = param.str("type");
+        if (type.substr(0, 5) != "tuple") return parse(type, out, e);
+
+        const json::Node* comps = param.get("components");
+        if (!comps || comps->type != json::Node::Type::Array) {
+            if (e) e->set(ErrorCode::other, "dyn: tuple without components");
+            return false;
+        }
+        if (comps->items.empty()) {
+            if (e) e->set(ErrorCode::other, "dyn: empty tuple");
+            return false;
+        }
+        TypeDesc base;
+        base.kind = Kind::Tuple;
+        for (const auto& c : comps->items) {
+            base.children.emplace_back();
+            if (!from_json(c, base.children.back(), e)) return false;
+            base.names.emplace_back(c.str("name"));
+        }
+        base.finalize();
+        // Wrap array suffixes, innermost first: tuple[2][] -> [2] then []
+        out = std::move(base);
+        std::string_view suffix = type.substr(5);
+        while (!suffix.empty()) {
+            const size_t close = suffix.find(']');
+            if (suffix[0] != '[' || close == std::string_view::npos) {
+                if (e)
+                    e->set(ErrorCode::other,
+                           "dyn: bad type '" + std::string(type) + "'");
+                return false;
+            }
+            TypeDesc arr;
+            if (!wrap_array(suffix.substr(1, close - 1), std::move(out), arr)) {
+                if (e)
+                    e->set(ErrorCode::other,
+                           "dyn: bad type '" + std::string(type) + "'");
+                return false;
+            }
+            out = std::move(arr);
+            suffix = suffix.substr(close + 1);
+        }
+        return true;
+    }
+
+private:
+    static bool parse_uint(std::string_view s, size_t& v) {
+        if (s.empty() || s.size() > 9) return false;
+        v = 0;
+        for (char c : s) {
+            if (c < '0' || c > '9') return false;
+            v = v * 10 + size_t(c - '0');
+        }
+        return true;
+    }
+
+    static bool wrap_array(std::string_view dim, TypeDesc&& elem,
+                           TypeDesc& out) {
+        out = TypeDesc{};
+        if (dim.empty()) {
+            out.kind = Kind::DynArray;
+        } else {
+            out.kind = Kind::StaticArray;
+            if (!parse_uint(dim, out.length) || out.length == 0) return false;
+        }
+        out.children.push_back(std::move(elem));
+        out.finalize();
+        return true;
+    }
+
+    // nested: t is an array element or tuple component, where "()" is not
+    // allowed (Solidity has no empty structs, and a zero-size element would
+    // make every array length plausible)
+    static bool parse_impl(std::string_view t, TypeDesc& out,
+                           bool nested = false) {
+        if (!t.empty() && t.back() == ']') {
+            // outermost dimension is the last suffix
+            const size_t open = t.rfind('[');
+            if (open == std::string_view::npos) return false;
+            TypeDesc elem;
+            if (!parse_impl(t.substr(0, open), elem, true)) return false;
+            return wrap_array(t.substr(open + 1, t.size() - open - 2),
+                              std::move(elem), out);
+        }
+        if (!t.empty() && t.front() == '(') {
+            if (t.back() != ')') return false;
+            out.kind = Kind::Tuple;
+            std::string_view inner = t.substr(1, t.size() - 2);
+            int depth = 0;
+            size_t start = 0;
+            for (size_t i = 0; i <= inner.size(); ++i) {
+                if (i < inner.size() && inner[i] == '(') ++depth;
+                if (i < inner.size() && inner[i] == ')') --depth;
+                if (i == inner.size() || (inner[i] == ',' && depth == 0)) {
+                    if (i == start) {
+                        if (inner.empty() && !nested) break;  // "()"
+                        return false;
+                    }
+                    out.children.emplace_back();
+                    if (!parse_impl(inner.substr(start, i - start),
+                                    out.children.back(), true))
+                        return false;
+                    start = i + 1;
+                }
+            }
+            out.finalize();
+            return depth == 0;
+        }
+        size_t n = 0;
+        if (t == "bool") {
+            out.kind = Kind::Bool;
+        } else if (t == "address") {
+            out.kind = Kind::Address;
+        } else if (t == "string") {
+            out.kind = Kind::String;
+        } else if (t == "bytes") {
+            out.kind = Kind::Bytes;
+        } else if (t.substr(0, 5) == "bytes") {
+            if (!parse_uint(t.substr(5), n) || n == 0 || n > 32) return false;
+            out.kind = Kind::FixedBytes;
+            out.bits = static_cast<uint16_t>(n);
+        } else if (t.substr(0, 4) == "uint" || t.substr(0, 3) == "int") {
+            const bool is_signed = t[0] == 'i';
+            std::string_view w = t.substr(is_signed ? 3 : 4);
+            if (w.empty()) {
+                n = 256;
+            } else if (!parse_uint(w, n) || n == 0 || n > 256 || n % 8) {
+                return false;
+            }
+            out.kind = is_signed ? Kind::Int : Kind::Uint;
+            out.bits = static_cast<uint16_t>(n);
+        } else {
+            return false;
+        }
+        out.finalize();
+        return true;
+    }
+};
+
+// ----------------- values -----------------
+struct Value {
+    using List = std::vector<Value>;  // arrays and tuples
+    using Storage = std::variant<boost::multiprecision::cpp_int, bool,
+                                 std::array<uint8_t, 20>,
+                                 std::vector<uint8_t>,  // bytes and bytesN
+                                 std::string, List>;
+    Storage v;
+
+    Value() = default;
+    Value(const boost::multiprecision::cpp_int& x) : v(x) {
+    }
+    template <class I, class = std::enable_if_t<std::is_integral<I>::value &&
+                                                !std::is_same<I, bool>::value>>
+    Value(I x) : v(boost::multiprecision::cpp_int(x)) {
+    }
+    Value(bool b) : v(b) {
+    }
+    Value(const std::array<uint8_t, 20>& a) : v(a) {
+    }
+    Value(std::vector<uint8_t> b) : v(std::move(b)) {
+    }
+    Value(std::string s) : v(std::move(s)) {
+    }
+    Value(const char* s) : v(std::string(s)) {
+    }
+    Value(List l) : v(std::move(l)) {
+    }
+
+    const boost::multiprecision::cpp_int& as_int() const {
+        return std::get<0>(v);
+    }
+    bool as_bool() const {
+        return std::get<1>(v);
+    }
+    const std::array<uint8_t, 20>& as_address() const {
+        return std::get<2>(v);
+    }
+    const std::vector<uint8_t>& as_bytes() const {
+        return std::get<3>(v);
+    }
+    const std::string& as_string() const {
+        return std::get<4>(v);
+    }
+    const List& as_list() const {
+        return std::get<5>(v);
+    }
+
+    bool operator==(const Value& o) const {
+        return v == o.v;
+    }
+    bool operator!=(const Value& o) const {
+        return !(v == o.v);
+    }
+};
+
+// ----------------- codec -----------------
+inline boost::multiprecision::cpp_int sign_extend_bits(
+    const boost::multiprecision::cpp_int& x, unsigned bits) {
+    using boost::multiprecision::cpp_int;
+    const cpp_int one = 1;
+    cpp_int v = x & ((one << bits) - 1);
+    if (((v >> (bits - 1)) & 1) != 0) v -= (one << bits);
+    return v;
+}
+
+// ----------------- compiled plans -----------------
+// A type is compiled once into a flat instruction list; encode and decode
+// run it with an explicit frame stack instead of recursing over TypeDesc.
+// Sequences (tuples and arrays) are bracketed by Open ... Close, and array
+// bodies loop by jumping from Close back to the first body instruction.
+
+enum class Op : uint8_t {
+    Uint,
+    Int,
+    Bool,
+    Address,
+    FixedBytes,
+    Bytes,
+    String,
+    Open,
+    Close
+};
+
+struct Insn {
+    Op op;
+    uint8_t flags{0};   // Open: kDynamic | kLoop | kLenPrefixed
+    uint16_t bits{0};   // Int width, FixedBytes size
+    uint32_t count{0};  // Open: tuple arity or static array length
+    uint32_t skip{0};   // Open: index after the matching Close
+    uint32_t head{0};   // Open: tuple head bytes, or array element stride
+
+    static constexpr uint8_t kDynamic = 1;      // reached through an offset
+    static constexpr uint8_t kLoop = 2;         // array: body per element
+    static constexpr uint8_t kLenPrefixed = 4;  // dynamic array
+};
+
+class Plan {
+public:
+    // Compile a parameter list (a tuple TypeDesc)
+    static Plan compile(const TypeDesc& params) {
+        Plan p;
+        p.arity_ = params.children.size();
+        p.head_bytes_ = 0;
+        for (const auto& c : params.children) {
+            p.head_bytes_ += c.dynamic ? 32 : 32 * c.head_words;
+            p.emit(c, 1);
+        }
+        return p;
+    }
+
+    size_t instructions() const {
+        return code_.size();
+    }
+
+    // Validate values against the plan and compute the encoded size
+    bool encoded_size(const Value::List& vs, size_t& out,
+                      Error* e = nullptr) const {
+        return run_encode(vs, nullptr, out, e);
+    }
+
+    bool encode(const Value::List& vs, uint8_t* out, size_t cap,
+                Error* e = nullptr) const {
+        size_t n = 0;
+        if (!run_encode(vs, nullptr, n, e)) return false;
+        if (cap < n) {
+            if (e) e->set(ErrorCode::buffer_too_small, "dyn: buffer too small");
+            return false;
+        }
+        return run_encode(vs, out, n, e);
+    }
+
+    bool decode(BytesSpan in, Value::List& out, Error* e = nullptr) const;
+
+private:
+    std::vector<Insn> code_;
+    size_t arity_{0};
+    size_t head_bytes_{0};
+    size_t depth_{1};
+
+    void emit(const TypeDesc& t, size_t depth) {
+        depth_ = std::max(depth_, depth + 1);
+        Insn in{};
+        switch (t.kind) {
+            case Kind::Uint: in.op = Op::Uint; break;
+            case Kind::Int: in.op = Op::Int; break;
+            case Kind::Bool: in.op = Op::Bool; break;
+            case Kind::Address: in.op = Op::Address; break;
+            case Kind::FixedBytes: in.op = Op::FixedBytes; break;
+            case Kind::Bytes: in.op = Op::Bytes; break;
+            case Kind::String: in.op = Op::String; break;
+            case Kind::Tuple:
+            case Kind::StaticArray:
+            case Kind::DynArray: {
+                in.op = Op::Open;
+                in.flags = t.dynamic ? Insn::kDynamic : 0;
+                if (t.kind == Kind::Tuple) {
+                    in.count = static_cast<uint32_t>(t.children.size());
+                    for (const auto& c : t.children)
+                        in.head += static_cast<uint32_t>(
+                            c.dynamic ? 32 : 32 * c.head_words);
+                } else {
+                    const TypeDesc& el = t.children[0];
+                    in.flags |= Insn::kLoop;
+                    if (t.kind == Kind::DynArray)
+                        in.flags |= Insn::kLenPrefixed;
+                    in.count = static_cast<uint32_t>(t.length);
+                    in.head = static_cast<uint32_t>(
+                        el.dynamic ? 32 : 32 * el.head_words);
+                }
+                const size_t at = code_.size();
+                code_.push_back(in);
+                for (const auto& c : t.children) emit(c, depth + 1);
+                code_.push_back(Insn{Op::Close});
+                code_[at].skip = static_cast<uint32_t>(code_.size());
+                return;
+            }
+        }
+        in.bits = t.bits;
+        code_.push_back(in);
+    }
+
+    // Sequence being encoded: values come from list, heads are written at
+    // head and dynamic data is appended at tail
+    struct EncFrame {
+        const Value::List* list;
+        size_t idx;
+        size_t start;
+        size_t head;
+        size_t tail;
+        uint32_t body;
+        size_t remaining;
+        bool loop;
+        bool dynamic;
+    };
+
+    static bool mismatch(Error* e, const char* what) {
+        if (e)
+            e->set(ErrorCode::other,
+                   std::string("dyn: value does not match ") + what);
+        return false;
+    }
+
+    // out == nullptr: measure and validate only
+    bool run_encode(const Value::List& vs, uint8_t* out, size_t& size,
+                    Error* e) const {
+        if (vs.size() != arity_) {
+            if (e) e->set(ErrorCode::other, "dyn: argument count mismatch");
+            return false;
+        }
+        std::vector<EncFrame> st;
+        st.reserve(depth_);
+        st.push_back(EncFrame{&vs, 0, 0, 0, head_bytes_, 0, 0, false, true});
+        const size_t n = code_.size();
+        for (size_t pc = 0; pc < n; ++pc) {
+            const Insn& in = code_[pc];
+            EncFrame& f = st.back();
+            if (in.op == Op::Close) {
+                if (f.loop && --f.remaining > 0) {
+                    pc = f.body - 1;
+                    continue;
+                }
+                const EncFrame done = f;
+                st.pop_back();
+                if (done.dynamic) st.back().tail = done.tail;
+                continue;
+            }
+            const Value& v = (*f.list)[f.idx++];
+            switch (in.op) {
+                case Op::Uint:
+                case Op::Int: {
+                    auto x = std::get_if<boost::multiprecision::cpp_int>(&v.v);
+                    if (!x) return mismatch(e, "integer");
+                    if (out) write_u256_big(out + f.head, *x);
+                    f.head += 32;
+                    break;
+                }
+                case Op::Bool: {
+                    auto b = std::get_if<bool>(&v.v);
+                    if (!b) return mismatch(e, "bool");
+                    if (out) {
+                        std::memset(out + f.head, 0, 32);
+                        out[f.head + 31] = *b ? 1 : 0;
+                    }
+                    f.head += 32;
+                    break;
+                }
+                case Op::Address: {
+                    auto a = std::get_if<std::array<uint8_t, 20>>(&v.v);
+                    if (!a) return mismatch(e, "address");
+                    if (out) {
+                        std::memset(out + f.head, 0, 12);
+                        std::memcpy(out + f.head + 12, a->data(), 20);
+                    }
+                    f.head += 32;
+                    break;
+                }
+                case Op::FixedBytes: {
+                    auto b = std::get_if<std::vector<uint8_t>>(&v.v);
+                    if (!b || b->size() != in.bits)
+                        return mismatch(e, "fixed bytes");
+                    if (out) {
+                        std::memset(out + f.head, 0, 32);
+                        std::memcpy(out + f.head, b->data(), in.bits);
+                    }
+                    f.head += 32;
+                    break;
+                }
+                case Op::Bytes:
+                case Op::String: {
+                    BytesSpan s;
+                    if (in.op == Op::Bytes) {
+                        auto b = std::get_if<std::vector<uint8_t>>(&v.v);
+                        if (!b) return mismatch(e, "bytes");
+                        s = as_bytes_span(*b);
+                    } else {
+                        auto str = std::get_if<std::string>(&v.v);
+                        if (!str) return mismatch(e, "string");
+                        s = as_bytes_span(*str);
+                    }
+                    if (out) {
+                        write_u256_imm(out + f.head, f.tail - f.start);
+                        write_u256_imm(out + f.tail, s.size());
+                        write_bytes_padded(out + f.tail + 32, s);
+                    }
+                    f.head += 32;
+                    f.tail += 32 + pad32(s.size());
+                    break;
+                }
+                case Op::Open: {
+                    auto l = std::get_if<Value::List>(&v.v);
+                    const bool loop = in.flags & Insn::kLoop;
+                    const bool lp = in.flags & Insn::kLenPrefixed;
+                    if (!l || (!lp && l->size() != in.count))
+                        return mismatch(e, loop ? "array" : "tuple");
+                    const size_t count = lp ? l->size() : in.count;
+                    const size_t head_bytes = loop ? count * in.head : in.head;
+                    EncFrame c{l, 0, 0, 0, 0, uint32_t(pc + 1), count, loop,
+                               (in.flags & Insn::kDynamic) != 0};
+                    if (c.dynamic) {
+                        if (out) write_u256_imm(out + f.head, f.tail - f.start);
+                        f.head += 32;
+                        c.start = f.tail;
+                        if (lp) {
+                            if (out) write_u256_imm(out + c.start, count);
+                            c.start += 32;
+                        }
+                    } else {
+                        c.start = f.head;
+                        f.head += head_bytes;
+                    }
+                    c.head = c.start;
+                    c.tail = c.start + head_bytes;
+                    if (count == 0) {
+                        if (c.dynamic) f.tail = c.tail;
+                        pc = in.skip - 1;
+                        break;
+                    }
+                    st.push_back(c);
+                    break;
+                }
+                case Op::Close:
+                    break;
+            }
+        }
+        size = st.back().tail;
+        return true;
+    }
+
+    // Sequence being decoded: input window [base, base + size)
+    struct DecFrame {
+        const uint8_t* base;
+        size_t size;
+        size_t head;
+        Value::List* list;
+        uint32_t body;
+        size_t remaining;
+        bool loop;
+    };
+};
+
+inline bool Plan::decode(BytesSpan in, Value::List& out, Error* e) const {
+    out.clear();
+    out.reserve(arity_);
+    std::vector<DecFrame> st;
+    st.reserve(depth_);
+    st.push_back(DecFrame{in.data(), in.size(), 0, &out, 0, 0, false});
+    // Offset of the current head word; path from the partly built lists
+    // (each open frame is building the last element of its parent)
+    auto fail = [&](ErrorCode c, const char* msg) {
+        if (e) {
+            const DecFrame& f = st.back();
+            e->set_static(c, msg, size_t(f.base + f.head - in.data()));
+            for (size_t k = st.size(); k-- > 0;)
+                e->path.push_outer(
+                    uint32_t(st[k].list->size() - (k + 1 < st.size())));
+        }
+        return false;
+    };
+    const size_t n = code_.size();
+    for (size_t pc = 0; pc < n; ++pc) {
+        const Insn& ins = code_[pc];
+        DecFrame& f = st.back();
+        if (ins.op == Op::Close) {
+            if (f.loop && --f.remaining > 0) {
+                pc = f.body - 1;
+                continue;
+            }
+            st.pop_back();
+            continue;
+        }
+        if (f.head + 32 > f.size)
+            return fail(ErrorCode::short_input, "dyn: head short");
+        const uint8_t* w = f.base + f.head;
+        switch (ins.op) {
+            case Op::Uint:
+                f.list->emplace_back(read_u256_big(w));
+                f.head += 32;
+                break;
+            case Op::Int:
+                f.list->emplace_back(
+                    sign_extend_bits(read_u256_big(w), ins.bits));
+                f.head += 32;
+                break;
+            case Op::Bool:
+                f.list->emplace_back(w[31] != 0);
+                f.head += 32;
+                break;
+            case Op::Address: {
+                std::array<uint8_t, 20> a;
+                std::memcpy(a.data(), w + 12, 20);
+                f.list->emplace_back(a);
+                f.head += 32;
+                break;
+            }
+            case Op::FixedBytes:
+                f.list->emplace_back(std::vector<uint8_t>(w, w + ins.bits));
+                f.head += 32;
+                break;
+            case Op::Bytes:
+            case Op::String: {
+                size_t off = 0, len = 0;
+                if (!read_size_word(w, off) || off > f.size ||
+                    f.size - off < 32)
+                    return fail(ErrorCode::bad_offset, "dyn: bad off");
+                const uint8_t* p = f.base + off;
+                if (!read_size_word(p, len) || len > f.size - off - 32)
+                    return fail(ErrorCode::out_of_range,
+                                "dyn: len out of range");
+                if (ins.op == Op::Bytes)
+                    f.list->emplace_back(
+                        std::vector<uint8_t>(p + 32, p + 32 + len));
+                else
+                    f.list->emplace_back(std::string(
+                        reinterpret_cast<const char*>(p + 32), len));
+                f.head += 32;
+                break;
+            }
+            case Op::Open: {
+                const bool loop = ins.flags & Insn::kLoop;
+                DecFrame c{nullptr, 0, 0, nullptr, uint32_t(pc + 1), ins.count,
+                           loop};
+                if (ins.flags & Insn::kDynamic) {
+                    size_t off = 0;
+                    if (!read_size_word(w, off) || off > f.size)
+                        return fail(ErrorCode::bad_offset, "dyn: bad off");
+                    c.base = f.base + off;
+                    c.size = f.size - off;
+                    f.head += 32;
+                    if (ins.flags & Insn::kLenPrefixed) {
+                        size_t len = 0;
+                        // head is 0 only for a hand-built empty tuple
+                        const size_t stride = std::max<uint32_t>(ins.head, 1);
+                        if (c.size < 32 || !read_size_word(c.base, len) ||
+                            len > (c.size - 32) / stride)
+                            return fail(ErrorCode::out_of_range,
+                                        "dyn: array len out of range");
+                        c.base += 32;
+                        c.size -= 32;
+                        c.remaining = len;
+                    }
+                } else {
+                    const size_t bytes =
+                        loop ? size_t(ins.count) * ins.head : ins.head;
+                    if (f.head + bytes > f.size)
+                        return fail(ErrorCode::short_input, "dyn: head short");
+                    c.base = w;
+                    c.size = bytes;
+                    f.head += bytes;
+                }
+                f.list->emplace_back(Value::List{});
+                c.list = &std::get<Value::List>(f.list->back().v);
+                const size_t items = loop ? c.remaining : ins.count;
+                if (items == 0) {
+                    pc = ins.skip - 1;
+                    break;
+                }
+                c.list->reserve(items);
+                st.push_back(c);
+                break;
+            }
+            case Op::Close:
+                break;
+        }
+    }
+    return true;
+}
+
+// Plans are cached by canonical parameter list, e.g. "(address,uint256)"
+inline std::shared_ptr<const Plan> plan_for(const TypeDesc& params) {
+    static std::mutex mu;
+    static std::unordered_map<std::string, std::shared_ptr<const Plan>> cache;
+    std::string key = params.canonical();
+    std::lock_guard<std::mutex> lock(mu);
+    auto it = cache.find(key);
+    if (it != cache.end()) return it->second;
+    auto p = std::make_shared<const Plan>(Plan::compile(params));
+    cache.emplace(std::move(key), p);
+    return p;
+}
+
+// Encoded size of values as a parameter list (a top-level tuple); fails when
+// the values do not match the types
+inline bool encoded_size(const TypeDesc& params_tuple, const Value::List& vs,
+                         size_t& out, Error* e = nullptr) {
+    return plan_for(params_tuple)->encoded_size(vs, out, e);
+}
+
+inline bool encode(const TypeDesc& params_tuple, const Value::List& vs,
+                   uint8_t* out, size_t cap, Error* e = nullptr) {
+    return plan_for(params_tuple)->encode(vs, out, cap, e);
+}
+
+inline bool decode(const TypeDesc& params_tuple, BytesSpan in,
+                   Value::List& out, Error* e = nullptr) {
+    return plan_for(params_tuple)->decode(in, out, e);
+}
+
+// ----------------- functions, events, ABI files -----------------
+struct Function {
+    std::string name;
+    std::string signature;  // canonical, e.g. "transfer(address,uint256)"
+    std::array<uint8_t, 4> selector{};
+    TypeDesc inputs;   // parameter list as a tuple
+    TypeDesc outputs;  // return list as a tuple
+    std::shared_ptr<const Plan> input_plan, output_plan;
+
+    // Resolve cached plans; Abi::parse does this for every function
+    void prepare() {
+        input_plan = plan_for(inputs);
+        output_plan = plan_for(outputs);
+    }
+
+    // Selector + encoded arguments; 0 when args do not match the inputs
+    size_t encoded_size(const Value::List& args) const {
+        size_t n = 0;
+        return in_plan().encoded_size(args, n) ? 4 + n : 0;
+    }
+    bool encode_call(uint8_t* out, size_t cap, const Value::List& args,
+                     Error* e = nullptr) const {
+        if (cap < 4) {
+            if (e) e->set(ErrorCode::buffer_too_small, "dyn: buffer too small");
+            return false;
+        }
+        std::memcpy(out, selector.data(), 4);
+        return in_plan().encode(args, out + 4, cap - 4, e);
+    }
+    bool decode_call(BytesSpan in, Value::List& args,
+                     Error* e = nullptr) const {
+        if (in.size() < 4 || std::memcmp(in.data(), selector.data(), 4) != 0) {
+            if (e)
+                e->set(ErrorCode::selector_mismatch, "dyn: selector mismatch");
+            return false;
+        }
+        return in_plan().decode(BytesSpan(in.data() + 4, in.size() - 4), args,
+                                e);
+    }
+    bool decode_result(BytesSpan in, Value::List& out,
+                       Error* e = nullptr) const {
+        return out_plan().decode(in, out, e);
+    }
+
+private:
+    const Plan& in_plan() const {
+        return input_plan ? *input_plan : *plan_for(inputs);
+    }
+    const Plan& out_plan() const {
+        return output_plan ? *output_plan : *plan_for(outputs);
+    }
+};
+
+struct Event {
+    std::string name;
+    std::string signature;
+    std::array<uint8_t, 32> topic0{};
+    bool anonymous{false};
+    TypeDesc inputs;            // all inputs, in declaration order
+    std::vector<bool> indexed;  // per input
+    TypeDesc data;              // the non-indexed inputs
+    std::shared_ptr<const Plan> data_plan;
+
+    // Decode the non-indexed inputs from the log data
+    bool decode_data(BytesSpan in, Value::List& out,
+                     Error* e = nullptr) const {
+        return (data_plan ? *data_plan : *plan_for(data)).decode(in, out, e);
+    }
+};
+
+struct Abi {
+    std::vector<Function> functions;
+    std::vector<Event> events;
+
+    // Lookup by name (first overload) or by full canonical signature
+    const Function* function(std::string_view key) const {
+        const bool by_sig = key.find('(') != std::string_view::npos;
+        for (const auto& f : functions)
+            if ((by_sig ? f.signature : f.name) == key) return &f;
+        return nullptr;
+    }
+    const Event* event(std::string_view key) const {
+        const bool by_sig = key.find('(') != std::string_view::npos;
+        for (const auto& ev : events)
+            if ((by_sig ? ev.signature : ev.name) == key) return &ev;
+        return nullptr;
+    }
+
+    static bool parse(std::string_view text, Abi& out, Error* e = nullptr) {
+        out = Abi{};
+        json::Node root;
+        if (!json::parse(text, root, e)) return false;
+        // Accept both a bare ABI array and a {"abi": [...]} artifact
+        const json::Node* list = &root;
+        if (root.type == json::Node::Type::Object) list = root.get("abi");
+        if (!list || list->type != json::Node::Type::Array) {
+            if (e) e->set(ErrorCode::other, "dyn: ABI must be a JSON array");
+            return false;
+        }
+        for (const auto& item : list->items) {
+            const std::string_view kind = item.str("type", "function");
+            if (kind != "function" && kind != "event") continue;
+            TypeDesc ins;
+            std::vector<bool> indexed;
+            if (!params(item.get("inputs"), ins, &indexed, e)) return false;
+            std::string sig = std::string(item.str("name")) + ins.canonical();
+            if (kind == "function") {
+                Function f;
+                f.name = std::string(item.str("name"));
+                f.selector = selector_of(sig);
+                f.signature = std::move(sig);
+                f.inputs = std::move(ins);
+                if (!params(item.get("outputs"), f.outputs, nullptr, e))
+                    return false;
+                f.prepare();
+                out.functions.push_back(std::move(f));
+            } else {
+                Event ev;
+                ev.name = std::string(item.str("name"));
+                ev.topic0 = keccak256(sig);
+                ev.signature = std::move(sig);
+                const json::Node* anon = item.get("anonymous");
+                ev.anonymous = anon && anon->boolean;
+                ev.data.kind = Kind::Tuple;
+                for (size_t i = 0; i < ins.children.size(); ++i)
+                    if (!indexed[i])
+                        ev.data.children.push_back(ins.children[i]);
+                ev.data.finalize();
+                ev.data_plan = plan_for(ev.data);
+                ev.inputs = std::move(ins);
+                ev.indexed = std::move(indexed);
+                out.events.push_back(std::move(ev));
+            }
+        }
+        return true;
+    }
+
+    static bool load_file(const std::string& path, Abi& out,
+                          Error* e = nullptr) {
+        std::ifstream f(path, std::ios::binary);
+        if (!f) {
+            if (e) e->set(ErrorCode::other, "dyn: cannot open " + path);
+            return false;
+        }
+        std::stringstream ss;
+        ss << f.rdbuf();
+        return parse(ss.str(), out, e);
+    }
+
+private:
+    static bool params(const json::Node* list, TypeDesc& out,
+                       std::vector<bool>* indexed, Error* e) {
+        out = TypeDesc{};
+        out.kind = Kind::Tuple;
+        if (list && list->type == json::Node::Type::Array) {
+            for (const auto& p : list->items) {
+                out.children.emplace_back();
+                if (!TypeDesc::from_json(p, out.children.back(), e))
+                    return false;
+                out.names.emplace_back(p.str("name"));
+                if (indexed) {
+                    const json::Node* ix = p.get("indexed");
+                    indexed->push_back(ix && ix->boolean);
+                }
+            }
+        }
+        out.finalize();
+        return true;
+    }
+};
+
+}  // namespace dyn
+}  // namespace abi
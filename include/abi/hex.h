@@ -0,0 +1,282 @@
+#pragma once
+#include <algorithm>
+
+#include "abi.h"
+#include "keccak.h"
+
+// Hex text <-> bytes without intermediate std::vector / std::string,
+// decoding ABI payloads straight from "0x..." JSON-RPC strings, and EIP-55
+// checksummed addresses.
+
+namespace abi {
+
+// Length of the "0x" / "0X" prefix of s (0 or 2)
+inline size_t hex_prefix_len(std::string_view s) {
+    return (s.size() >= 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) ? 2
+                                                                          : 0;
+}
+
+// Non-allocating, non-throwing counterparts of parse_hex, addr_from_hex and
+// bytes_to_hex_string (abi.h) writing into caller buffers.
+
+// Parse a (optionally 0x-prefixed) hex string into out[cap]; odd-length
+// input gets an implied leading zero, as with parse_hex. n receives the byte
+// count. Error::offset is the index of the offending character in hex.
+inline bool parse_hex(std::string_view hex, uint8_t* out, size_t cap,
+                      size_t& n, Error* e = nullptr) {
+    size_t p = hex_prefix_len(hex);
+    const size_t digits = hex.size() - p;
+    n = (digits + 1) / 2;
+    if (n > cap) {
+        if (e) e->set(ErrorCode::buffer_too_small, "hex: buffer too small");
+        return false;
+    }
+    size_t o = 0;
+    if (digits & 1) {
+        const uint8_t v = hex_detail::nibbles.v[static_cast<uint8_t>(hex[p])];
+        if (v == 0xff) {
+            if (e) e->set(ErrorCode::invalid_text, "hex: invalid character", p);
+            return false;
+        }
+        out[o++] = v;
+        ++p;
+    }
+    size_t bad = 0;
+    if (!hex_decode(hex.data() + p, hex.size() - p, out + o, &bad)) {
+        if (e)
+            e->set(ErrorCode::invalid_text, "hex: invalid character", p + bad);
+        return false;
+    }
+    return true;
+}
+
+// Exactly 40 hex digits after an optional prefix
+inline bool addr_from_hex(std::string_view hex, std::array<uint8_t, 20>& out,
+                          Error* e = nullptr) {
+    const size_t p = hex_prefix_len(hex);
+    if (hex.size() - p != 40) {
+        if (e)
+            e->set(ErrorCode::invalid_text, "hex: address must be 40 digits");
+        return false;
+    }
+    size_t bad = 0;
+    if (!hex_decode(hex.data() + p, 40, out.data(), &bad)) {
+        if (e)
+            e->set(ErrorCode::invalid_text, "hex: invalid character", p + bad);
+        return false;
+    }
+    return true;
+}
+
+// "0x" + lowercase hex into out[cap]; returns the characters written
+// (2 + 2 * bytes.size()), or 0 when cap is too small. No terminator.
+inline size_t bytes_to_hex_string(BytesSpan bytes, char* out, size_t cap) {
+    const size_t need = 2 + 2 * bytes.size();
+    if (cap < need) return 0;
+    out[0] = '0';
+    out[1] = 'x';
+    hex_encode(bytes.data(), bytes.size(), out + 2);
+    return need;
+}
+
+namespace hex_detail {
+
+// EIP-55 case of hex digit i of an address given keccak(lowercase hex)
+inline bool checksum_upper(const uint8_t* hash, size_t i) {
+    return ((i & 1) ? (hash[i / 2] & 0x0f) : (hash[i / 2] >> 4)) >= 8;
+}
+
+// Uppercase the letters of 40 lowercase digits at h as EIP-55 requires
+inline void apply_checksum(char* h, const uint8_t* hash) {
+    for (size_t i = 0; i < 40; ++i)
+        if (h[i] >= 'a' && checksum_upper(hash, i))
+            h[i] = static_cast<char>(h[i] - 32);
+}
+
+// Index of the first letter of 40 digits at h whose case disagrees with
+// hash, or 40
+inline size_t checksum_mismatch(const char* h, const uint8_t* hash) {
+    for (size_t i = 0; i < 40; ++i)
+        if (h[i] >= 'A' && (h[i] <= 'F') != checksum_upper(hash, i)) return i;
+    return 40;
+}
+
+// Validate 40 digits after an optional prefix and copy them lowercased
+// ('0'-'9' already have bit 0x20 set)
+inline bool checksum_digits(std::string_view hex, char* lower, Error* e) {
+    const size_t p = hex_prefix_len(hex);
+    if (hex.size() - p != 40) {
+        if (e)
+            e->set(ErrorCode::invalid_text, "hex: address must be 40 digits");
+        return false;
+    }
+    const size_t bad = first_invalid(hex.data() + p, 40);
+    if (bad < 40) {
+        if (e)
+            e->set(ErrorCode::invalid_text, "hex: invalid character", p + bad);
+        return false;
+    }
+    for (size_t i = 0; i < 40; ++i) lower[i] = hex[p + i] | 0x20;
+    return true;
+}
+
+inline constexpr size_t checksum_batch = 16;
+
+}  // namespace hex_detail
+
+// "0x" + EIP-55 mixed-case hex of addr[20] into out[42]. No terminator.
+inline void addr_to_checksum_hex(const uint8_t* addr, char* out) {
+    out[0] = '0';
+    out[1] = 'x';
+    hex_encode(addr, 20, out + 2);
+    uint8_t hash[32];
+    keccak256(reinterpret_cast<const uint8_t*>(out + 2), 40, hash);
+    hex_detail::apply_checksum(out + 2, hash);
+}
+
+inline std::string addr_to_checksum_hex(const std::array<uint8_t, 20>& addr) {
+    std::string out(42, '0');
+    addr_to_checksum_hex(addr.data(), out.data());
+    return out;
+}
+
+// n addresses as 42-character strings packed back to back in out[42 * n],
+// hashed several at a time with keccak256_many
+inline void addr_to_checksum_hex(const std::array<uint8_t, 20>* addrs,
+                                 size_t n, char* out) {
+    uint8_t hash[hex_detail::checksum_batch][32];
+    for (size_t k = 0; k < n; k += hex_detail::checksum_batch) {
+        const size_t m = std::min(hex_detail::checksum_batch, n - k);
+        char* o = out + 42 * k;
+        for (size_t i = 0; i < m; ++i) {
+            o[42 * i] = '0';
+            o[42 * i + 1] = 'x';
+            hex_encode(addrs[k + i].data(), 20, o + 42 * i + 2);
+        }
+        keccak256_many(reinterpret_cast<const uint8_t*>(o + 2), 42, 40, m,
+                       hash[0]);
+        for (size_t i = 0; i < m; ++i)
+            hex_detail::apply_checksum(o + 42 * i + 2, hash[i]);
+    }
+}
+
+// True when hex (40 digits, optional prefix) has exactly the EIP-55 case
+// pattern; all-lowercase input only passes if it has no letters to raise.
+// Error::offset is the index of the first invalid or wrongly cased digit.
+inline bool addr_validate_checksum(std::string_view hex, Error* e = nullptr) {
+    char lower[40];
+    if (!hex_detail::checksum_digits(hex, lower, e)) return false;
+    uint8_t hash[32];
+    keccak256(reinterpret_cast<const uint8_t*>(lower), 40, hash);
+    const size_t p = hex_prefix_len(hex);
+    const size_t i = hex_detail::checksum_mismatch(hex.data() + p, hash);
+    if (i < 40) {
+        if (e) e->set(ErrorCode::invalid_text, "hex: bad checksum", p + i);
+        return false;
+    }
+    return true;
+}
+
+// Batch form: ok[i] receives the result for hex[i]; returns the number of
+// valid entries
+inline size_t addr_validate_checksum(const std::string_view* hex, size_t n,
+                                     bool* ok) {
+    char lower[hex_detail::checksum_batch][40];
+    uint8_t hash[hex_detail::checksum_batch][32];
+    size_t idx[hex_detail::checksum_batch];
+    size_t valid = 0;
+    for (size_t k = 0; k < n; k += hex_detail::checksum_batch) {
+        const size_t m = std::min(hex_detail::checksum_batch, n - k);
+        size_t h = 0;  // well-formed entries queued for hashing
+        for (size_t i = 0; i < m; ++i) {
+            ok[k + i] = false;
+            if (hex_detail::checksum_digits(hex[k + i], lower[h], nullptr))
+                idx[h++] = k + i;
+        }
+        keccak256_many(reinterpret_cast<const uint8_t*>(lower[0]), 40, 40, h,
+                       hash[0]);
+        for (size_t j = 0; j < h; ++j) {
+            const std::string_view s = hex[idx[j]];
+            ok[idx[j]] = hex_detail::checksum_mismatch(
+                             s.data() + hex_prefix_len(s), hash[j]) == 40;
+            valid += ok[idx[j]];
+        }
+    }
+    return valid;
+}
+
+// Convert a (optionally 0x-prefixed) hex string into scratch, reusing its
+// capacity, and point out at the bytes. Error::offset is the index of the
+// offending character in hex.
+inline bool hex_to_span(std::string_view hex, std::vector<uint8_t>& scratch,
+                        BytesSpan& out, Error* e = nullptr) {
+    const size_t p = hex_prefix_len(hex);
+    const size_t n = hex.size() - p;
+    if (n & 1) {
+        if (e) e->set(ErrorCode::invalid_text, "hex: odd length");
+        return false;
+    }
+    scratch.resize(n / 2);
+    size_t bad = 0;
+    if (!hex_decode(hex.data() + p, n, scratch.data(), &bad)) {
+        if (e)
+            e->set(ErrorCode::invalid_text, "hex: invalid character", p + bad);
+        return false;
+    }
+    out = BytesSpan(scratch.data(), scratch.size());
+    return true;
+}
+
+// decode_from<Schema> on a hex payload. Static schemas convert only the
+// head bytes they read into a stack buffer (trailing text is checked for
+// valid digits but not converted, as decode_from ignores trailing bytes);
+// dynamic ones go through scratch. Malformed text is rejected either way.
+template <class Schema, class Out>
+inline bool decode_hex(std::string_view hex, Out& out,
+                       std::vector<uint8_t>& scratch, Error* e = nullptr) {
+    if constexpr (!traits<Schema>::is_dynamic &&
+                  traits<Schema>::head_words <= 32) {
+        (void)scratch;
+        constexpr size_t need = 32 * traits<Schema>::head_words;
+        const size_t p = hex_prefix_len(hex);
+        const size_t n = hex.size() - p;
+        if (n & 1) {
+            if (e) e->set(ErrorCode::invalid_text, "hex: odd length");
+            return false;
+        }
+        if (n < 2 * need) {
+            if (e) e->set(ErrorCode::short_input, "hex: short");
+            return false;
+        }
+        uint8_t buf[need];
+        size_t bad = 0;
+        if (!hex_decode(hex.data() + p, 2 * need, buf, &bad)) {
+            if (e)
+                e->set(ErrorCode::invalid_text,
+                       "hex: invalid character", p + bad);
+            return false;
+        }
+        const size_t tail = p + 2 * need;
+        bad = hex_detail::first_invalid(hex.data() + tail, hex.size() - tail);
+        if (tail + bad < hex.size()) {
+            if (e)
+                e->set(ErrorCode::invalid_text,
+                       "hex: invalid character", tail + bad);
+            return false;
+        }
+        return decode_from<Schema>(BytesSpan(buf, need), out, e);
+    } else {
+        BytesSpan in;
+        return hex_to_span(hex, scratch, in, e) &&
+               decode_from<Schema>(in, out, e);
+    }
+}
+
+// Same with a thread-local scratch buffer
+template <class Schema, class Out>
+inline bool decode_hex(std::string_view hex, Out& out, Error* e = nullptr) {
+    thread_local std::vector<uint8_t> scratch;
+    return decode_hex<Schema>(hex, out, scratch, e);
+}
+
+}  // namespace abi
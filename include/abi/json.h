@@ -0,0 +1,631 @@
+#pragma once
+#include "abi.h"
+#include "hex.h"
+#include "u256.h"
+
+// JSON output for decoded values (abi::to_json<Schema>) and straight from
+// encoded payloads (abi::to_json_view<Schema>). Output goes to a sink with
+//   void put(char c);
+//   void write(const char* p, size_t n);
+// BufferSink writes into a caller-provided buffer; nothing is allocated per
+// field. Integers are emitted as JSON strings (decimal, or 0x-prefixed hex
+// quantities), addresses and bytes as 0x-prefixed hex, named structs as
+// objects keyed by field name, arrays and unnamed tuples as arrays.
+// Negative integers keep a leading '-' in both forms ("-0x1f").
+
+namespace abi {
+
+struct JsonOptions {
+    bool hex_numbers{false};         // "0x1f" instead of "31"
+    bool checksum_addresses{false};  // EIP-55 mixed case instead of lowercase
+};
+
+// Sink over caller memory. Writes stop at cap but size keeps counting, so
+// after an overflow size() is the capacity a retry needs.
+struct BufferSink {
+    char* data_{nullptr};
+    size_t cap_{0};
+    size_t size_{0};
+
+    BufferSink(char* data, size_t cap) : data_(data), cap_(cap) {
+    }
+    void put(char c) {
+        if (size_ < cap_) data_[size_] = c;
+        ++size_;
+    }
+    void write(const char* p, size_t n) {
+        if (size_ < cap_)
+            std::memcpy(data_ + size_, p, std::min(n, cap_ - size_));
+        size_ += n;
+    }
+    size_t size() const {
+        return size_;
+    }
+    bool ok() const {
+        return size_ <= cap_;
+    }
+    std::string_view view() const {
+        return std::string_view(data_, std::min(size_, cap_));
+    }
+};
+
+namespace json_detail {
+
+// Magnitude of an integer as little-endian 64-bit limbs (at most 4)
+struct Limbs {
+    uint64_t v[4]{};
+    size_t n{0};  // significant limbs
+    bool neg{false};
+
+    void trim() {
+        while (n && v[n - 1] == 0) --n;
+    }
+};
+
+// Minimal hex digits of l (no prefix, "0" for zero); returns the length
+inline size_t limbs_to_hex(char* out, const Limbs& l) {
+    if (l.n == 0) {
+        out[0] = '0';
+        return 1;
+    }
+    size_t len = 0;
+    bool lead = true;
+    for (size_t i = l.n; i-- > 0;) {
+        for (int s = 60; s >= 0; s -= 4) {
+            const unsigned d = (l.v[i] >> s) & 0xf;
+            if (lead && d == 0) continue;
+            lead = false;
+            out[len++] = hex_chars[d];
+        }
+    }
+    return len;
+}
+
+// cpp_int -> Limbs; false when the magnitude needs more than 256 bits
+inline bool to_limbs(const boost::multiprecision::cpp_int& x, Limbs& l) {
+    u256 m;
+    if (!u256_from_cpp_int(x, m)) return false;
+    std::memcpy(l.v, m.limbs.data(), sizeof(l.v));
+    l.n = 4;
+    l.trim();
+    l.neg = x.sign() < 0;
+    return true;
+}
+
+// 32-byte big-endian word -> Limbs, sign-magnitude when is_signed
+inline Limbs word_limbs(const uint8_t* w, bool is_signed) {
+    Limbs l;
+    std::memcpy(l.v, u256::from_be(w).limbs.data(), sizeof(l.v));
+    if (is_signed && (w[0] & 0x80)) {
+        // two's complement negate
+        l.neg = true;
+        unsigned carry = 1;
+        for (int i = 0; i < 4; ++i) {
+            l.v[i] = ~l.v[i] + carry;
+            carry = carry && l.v[i] == 0;
+        }
+    }
+    l.n = 4;
+    l.trim();
+    return l;
+}
+
+template <class Sink>
+inline void write_limbs(Sink& s, const Limbs& l, const JsonOptions& opt) {
+    char buf[84];
+    size_t n = 0;
+    buf[n++] = '"';
+    if (l.neg && l.n) buf[n++] = '-';
+    if (opt.hex_numbers) {
+        buf[n++] = '0';
+        buf[n++] = 'x';
+        n += limbs_to_hex(buf + n, l);
+    } else {
+        u256 m;
+        std::memcpy(m.limbs.data(), l.v, sizeof(l.v));
+        n += u256_to_decimal(buf + n, m);
+    }
+    buf[n++] = '"';
+    s.write(buf, n);
+}
+
+template <class Sink, class T>
+inline void write_integer(Sink& s, const T& v, const JsonOptions& opt) {
+    Limbs l;
+    if constexpr (std::is_integral_v<T>) {
+        using U = std::make_unsigned_t<T>;
+        U m = static_cast<U>(v);
+        if constexpr (std::is_signed_v<T>) {
+            if (v < 0) {
+                l.neg = true;
+                m = static_cast<U>(U(0) - m);
+            }
+        }
+        l.v[0] = static_cast<uint64_t>(m);
+        l.n = l.v[0] ? 1 : 0;
+    } else if (!to_limbs(v, l)) {
+        // Wider than any ABI integer; fall back to boost formatting
+        const std::string str =
+            opt.hex_numbers ? "0x" + v.str(0, std::ios_base::hex) : v.str();
+        s.put('"');
+        s.write(str.data(), str.size());
+        s.put('"');
+        return;
+    }
+    write_limbs(s, l, opt);
+}
+
+template <class Sink>
+inline void write_hex(Sink& s, const uint8_t* p, size_t n) {
+    char buf[128];
+    s.write("\"0x", 3);
+    while (n) {
+        const size_t k = std::min(n, sizeof(buf) / 2);
+        hex_encode(p, k, buf);
+        s.write(buf, 2 * k);
+        p += k;
+        n -= k;
+    }
+    s.put('"');
+}
+
+template <class Sink>
+inline void write_address(Sink& s, const uint8_t* a, const JsonOptions& opt) {
+    char buf[44];
+    buf[0] = '"';
+    if (opt.checksum_addresses) {
+        addr_to_checksum_hex(a, buf + 1);
+    } else {
+        buf[1] = '0';
+        buf[2] = 'x';
+        hex_encode(a, 20, buf + 3);
+    }
+    buf[43] = '"';
+    s.write(buf, 44);
+}
+
+// Checksummed addresses hashed checksum_batch at a time; first tracks the
+// separator across calls
+template <class Sink>
+inline void write_checksummed(Sink& s, const std::array<uint8_t, 20>* a,
+                              size_t n, bool& first) {
+    char buf[42 * hex_detail::checksum_batch];
+    addr_to_checksum_hex(a, n, buf);
+    for (size_t i = 0; i < n; ++i) {
+        if (!first) s.put(',');
+        first = false;
+        s.put('"');
+        s.write(buf + 42 * i, 42);
+        s.put('"');
+    }
+}
+
+template <class Sink>
+inline void write_string(Sink& s, const char* p, size_t n) {
+    s.put('"');
+    size_t run = 0;  // pending bytes that need no escaping
+    for (size_t i = 0; i < n; ++i) {
+        const unsigned char c = static_cast<unsigned char>(p[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            ++run;
+            continue;
+        }
+        s.write(p + i - run, run);
+        run = 0;
+        char esc[6] = {'\\', 'u', '0', '0', hex_chars[c >> 4],
+                       hex_chars[c & 0x0f]};
+        switch (c) {
+            case '"':
+                s.write("\\\"", 2);
+                break;
+            case '\\':
+                s.write("\\\\", 2);
+                break;
+            case '\n':
+                s.write("\\n", 2);
+                break;
+            case '\r':
+                s.write("\\r", 2);
+                break;
+            case '\t':
+                s.write("\\t", 2);
+                break;
+            default:
+                s.write(esc, 6);
+        }
+    }
+    s.write(p + n - run, run);
+    s.put('"');
+}
+
+template <class T>
+struct type_tag {
+    using type = T;
+};
+
+}  // namespace json_detail
+
+template <class Schema>
+struct json_traits;
+
+template <int N>
+struct json_traits<uint_t<N>> {
+    template <class Sink, class V>
+    static void write(Sink& s, const V& v, const JsonOptions& opt) {
+        json_detail::write_integer(s, v, opt);
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const JsonOptions& opt, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "uintN: short");
+            return false;
+        }
+        json_detail::write_limbs(s, json_detail::word_limbs(in.data(), false),
+                                 opt);
+        return true;
+    }
+};
+
+template <int N>
+struct json_traits<int_t<N>> {
+    template <class Sink, class V>
+    static void write(Sink& s, const V& v, const JsonOptions& opt) {
+        json_detail::write_integer(s, v, opt);
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const JsonOptions& opt, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "intN: short");
+            return false;
+        }
+        json_detail::write_limbs(s, json_detail::word_limbs(in.data(), true),
+                                 opt);
+        return true;
+    }
+};
+
+template <>
+struct json_traits<bool_t> {
+    template <class Sink>
+    static void write(Sink& s, bool v, const JsonOptions&) {
+        if (v)
+            s.write("true", 4);
+        else
+            s.write("false", 5);
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const JsonOptions& opt, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "bool: short");
+            return false;
+        }
+        write(s, in.data()[31] != 0, opt);
+        return true;
+    }
+};
+
+template <>
+struct json_traits<address20> {
+    template <class Sink>
+    static void write(Sink& s, const std::array<uint8_t, 20>& v,
+                      const JsonOptions& opt) {
+        json_detail::write_address(s, v.data(), opt);
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const JsonOptions& opt, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "address: short");
+            return false;
+        }
+        json_detail::write_address(s, in.data() + 12, opt);
+        return true;
+    }
+};
+
+template <>
+struct json_traits<bytes> {
+    template <class Sink, class V>
+    static void write(Sink& s, const V& v, const JsonOptions&) {
+        const BytesSpan b = as_bytes_span(v);
+        json_detail::write_hex(s, b.data(), b.size());
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const JsonOptions&, Error* e) {
+        size_t len = 0;
+        if (in.size() < 32 || !read_size_word(in.data(), len)) {
+            if (e) e->set(ErrorCode::short_input, "bytes: short");
+            return false;
+        }
+        if (len > in.size() - 32) {
+            if (e) e->set(ErrorCode::out_of_range, "bytes: len out of range");
+            return false;
+        }
+        json_detail::write_hex(s, in.data() + 32, len);
+        return true;
+    }
+};
+
+template <>
+struct json_traits<string_t> {
+    template <class Sink>
+    static void write(Sink& s, std::string_view v, const JsonOptions&) {
+        json_detail::write_string(s, v.data(), v.size());
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const JsonOptions&, Error* e) {
+        size_t len = 0;
+        if (in.size() < 32 || !read_size_word(in.data(), len)) {
+            if (e) e->set(ErrorCode::short_input, "string: short");
+            return false;
+        }
+        if (len > in.size() - 32) {
+            if (e) e->set(ErrorCode::out_of_range, "string: len out of range");
+            return false;
+        }
+        json_detail::write_string(
+            s, reinterpret_cast<const char*>(in.data() + 32), len);
+        return true;
+    }
+};
+
+namespace json_detail {
+
+template <class T, class Sink, class Range>
+inline void write_elems(Sink& s, const Range& r, const JsonOptions& opt) {
+    s.put('[');
+    bool first = true;
+    if constexpr (std::is_same_v<T, address20>) {
+        if (opt.checksum_addresses) {
+            const size_t n = std::size(r);
+            for (size_t k = 0; k < n; k += hex_detail::checksum_batch)
+                write_checksummed(
+                    s, std::data(r) + k,
+                    std::min(hex_detail::checksum_batch, n - k), first);
+            s.put(']');
+            return;
+        }
+    }
+    for (const auto& x : r) {
+        if (!first) s.put(',');
+        first = false;
+        json_traits<T>::write(s, x, opt);
+    }
+    s.put(']');
+}
+
+// n elements laid out as a head area at in (static elements inline, dynamic
+// ones as offsets relative to in). base is where in starts within the
+// array's own encoding, so error offsets match traits<>::decode.
+template <class T, class Sink>
+inline bool view_elems(Sink& s, BytesSpan in, size_t base, size_t n,
+                       const JsonOptions& opt, Error* e, const char* short_msg,
+                       const char* off_msg) {
+    constexpr size_t stride =
+        traits<T>::is_dynamic ? 32 : 32 * traits<T>::head_words;
+    if (n > in.size() / stride) {
+        if (e) e->set_static(ErrorCode::short_input, short_msg);
+        return false;
+    }
+    s.put('[');
+    if constexpr (std::is_same_v<T, address20>) {
+        if (opt.checksum_addresses) {
+            std::array<uint8_t, 20> a[hex_detail::checksum_batch];
+            bool first = true;
+            for (size_t k = 0; k < n; k += hex_detail::checksum_batch) {
+                const size_t m = std::min(hex_detail::checksum_batch, n - k);
+                for (size_t i = 0; i < m; ++i)
+                    std::memcpy(a[i].data(), in.data() + (k + i) * 32 + 12, 20);
+                write_checksummed(s, a, m, first);
+            }
+            s.put(']');
+            return true;
+        }
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (i) s.put(',');
+        const uint8_t* h = in.data() + i * stride;
+        if constexpr (traits<T>::is_dynamic) {
+            size_t off = 0;
+            if (!read_size_word(h, off) || off > in.size()) {
+                if (e)
+                    e->set_static(ErrorCode::bad_offset, off_msg,
+                                  base + i * stride);
+                return false;
+            }
+            if (!json_traits<T>::view(
+                    s, BytesSpan(in.data() + off, in.size() - off), opt, e)) {
+                if (e) e->nest(uint32_t(i), base + off);
+                return false;
+            }
+        } else {
+            if (!json_traits<T>::view(s, BytesSpan(h, stride), opt, e)) {
+                if (e) e->nest(uint32_t(i), base + i * stride);
+                return false;
+            }
+        }
+    }
+    s.put(']');
+    return true;
+}
+
+template <class Sink>
+inline void write_key(Sink& s, const char* const* names, size_t i) {
+    if (i) s.put(',');
+    if (!names) return;
+    s.put('"');
+    s.write(names[i], std::strlen(names[i]));
+    s.write("\":", 2);
+}
+
+// Tuple fields from the encoding at in; names == nullptr emits an array
+template <class... Ts, class Sink>
+inline bool view_fields(Sink& s, BytesSpan in, const char* const* names,
+                        const JsonOptions& opt, Error* e) {
+    constexpr size_t need = 32 * traits<tuple<Ts...>>::head_words_static;
+    if (in.size() < need) {
+        if (e) e->set(ErrorCode::short_input, "tuple: head short");
+        return false;
+    }
+    s.put(names ? '{' : '[');
+    size_t head = 0;
+    bool ok = true;
+    auto field = [&](auto tag, size_t i) {
+        using T = typename decltype(tag)::type;
+        if (!ok) return;
+        write_key(s, names, i);
+        if constexpr (traits<T>::is_dynamic) {
+            size_t off = 0;
+            if (!read_size_word(in.data() + head, off) || off > in.size()) {
+                if (e) e->set(ErrorCode::bad_offset, "tuple: bad off", head);
+                ok = false;
+                return;
+            }
+            head += 32;
+            ok = json_traits<T>::view(
+                s, BytesSpan(in.data() + off, in.size() - off), opt, e);
+            if (!ok && e) e->nest(uint32_t(i), off);
+        } else {
+            const size_t n = 32 * traits<T>::head_words;
+            ok = json_traits<T>::view(s, BytesSpan(in.data() + head, n), opt,
+                                      e);
+            if (!ok && e) e->nest(uint32_t(i), head);
+            head += n;
+        }
+    };
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (field(type_tag<Ts>{}, I), ...);
+    }(std::index_sequence_for<Ts...>{});
+    if (ok) s.put(names ? '}' : ']');
+    return ok;
+}
+
+template <class... Ts, class Sink, class Tup>
+inline void write_fields(Sink& s, const Tup& t, const char* const* names,
+                         const JsonOptions& opt) {
+    s.put(names ? '{' : '[');
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        ((write_key(s, names, I),
+          json_traits<Ts>::write(s, std::get<I>(t), opt)),
+         ...);
+    }(std::index_sequence_for<Ts...>{});
+    s.put(names ? '}' : ']');
+}
+
+template <class Schema>
+struct tuple_of;
+template <class... Ts>
+struct tuple_of<tuple<Ts...>> {
+    template <class Sink, class Tup>
+    static void write(Sink& s, const Tup& t, const char* const* names,
+                      const JsonOptions& opt) {
+        write_fields<Ts...>(s, t, names, opt);
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const char* const* names,
+                     const JsonOptions& opt, Error* e) {
+        return view_fields<Ts...>(s, in, names, opt, e);
+    }
+};
+
+}  // namespace json_detail
+
+template <class T, size_t N>
+struct json_traits<static_array<T, N>> {
+    template <class Sink, class V>
+    static void write(Sink& s, const V& v, const JsonOptions& opt) {
+        json_detail::write_elems<T>(s, v, opt);
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const JsonOptions& opt, Error* e) {
+        return json_detail::view_elems<T>(s, in, 0, N, opt, e,
+                                          "static_array: short",
+                                          "static_array: bad off");
+    }
+};
+
+template <class T>
+struct json_traits<dyn_array<T>> {
+    template <class Sink, class V>
+    static void write(Sink& s, const V& v, const JsonOptions& opt) {
+        json_detail::write_elems<T>(s, v, opt);
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const JsonOptions& opt, Error* e) {
+        size_t len = 0;
+        if (in.size() < 32 || !read_size_word(in.data(), len)) {
+            if (e) e->set(ErrorCode::short_input, "dyn_array: short");
+            return false;
+        }
+        return json_detail::view_elems<T>(
+            s, BytesSpan(in.data() + 32, in.size() - 32), 32, len, opt, e,
+            traits<T>::is_dynamic ? "dyn_array: offs short"
+                                  : "dyn_array: inline short",
+            "dyn_array: bad off");
+    }
+};
+
+template <class... Ts>
+struct json_traits<tuple<Ts...>> {
+    template <class Sink, class V>
+    static void write(Sink& s, const V& v, const JsonOptions& opt) {
+        json_detail::write_fields<Ts...>(s, v, nullptr, opt);
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const JsonOptions& opt, Error* e) {
+        return json_detail::view_fields<Ts...>(s, in, nullptr, opt, e);
+    }
+};
+
+// Named structs become objects keyed by field_names; a plain std::tuple
+// value is written as an array like the underlying schema
+template <class Schema>
+struct json_traits {
+    template <class Sink, class V>
+    static void write(Sink& s, const V& v, const JsonOptions& opt) {
+        using Fields = json_detail::tuple_of<typename Schema::schema>;
+        if constexpr (std::is_same_v<V, Schema>) {
+            Fields::write(s, Schema::tie(v), Schema::field_names.data(), opt);
+        } else {
+            Fields::write(s, v, nullptr, opt);
+        }
+    }
+    template <class Sink>
+    static bool view(Sink& s, BytesSpan in, const JsonOptions& opt, Error* e) {
+        return json_detail::tuple_of<typename Schema::schema>::view(
+            s, in, Schema::field_names.data(), opt, e);
+    }
+};
+
+// Write a decoded value of Schema as JSON
+template <class Schema, class T, class Sink>
+inline void to_json(const T& value, Sink& sink, const JsonOptions& opt = {}) {
+    json_traits<Schema>::write(sink, value, opt);
+}
+
+// Write JSON straight from an encoded payload laid out like decode_from
+// expects, without decoding into owned values first
+template <class Schema, class Sink>
+inline bool to_json_view(BytesSpan in, Sink& sink, const JsonOptions& opt = {},
+                         Error* e = nullptr) {
+    if constexpr (needs_top_ptr<Schema>::value) {
+        size_t off = 0;
+        if (in.size() < 32 || !read_size_word(in.data(), off)) {
+            if (e) e->set(ErrorCode::short_input, "top: short");
+            return false;
+        }
+        if (off > in.size()) {
+            if (e) e->set(ErrorCode::bad_offset, "top: bad off");
+            return false;
+        }
+        if (!json_traits<Schema>::view(
+                sink, BytesSpan(in.data() + off, in.size() - off), opt, e)) {
+            if (e) e->shift(off);
+            return false;
+        }
+        return true;
+    } else {
+        return json_traits<Schema>::view(sink, in, opt, e);
+    }
+}
+
+}  // namespace abi
@@ -0,0 +1,284 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Keccak-256 (the pre-NIST padding used by Ethereum) for selectors, event
+// topics and checksums computed at runtime. keccak256_many hashes equal-length
+// messages several at a time, one message per SIMD lane.
+
+namespace abi {
+namespace keccak_detail {
+
+static constexpr uint64_t round_constants[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+    0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+
+inline uint64_t rotl(uint64_t x, int n) {
+    return (x << n) | (x >> ((64 - n) & 63));
+}
+
+// rho rotation and pi destination of each lane
+static constexpr int rho[25] = {0,  1,  62, 28, 27, 36, 44, 6,  55,
+                                20, 3,  10, 43, 25, 39, 41, 45, 15,
+                                21, 8,  18, 2,  61, 56, 14};
+static constexpr int pi[25] = {0,  10, 20, 5,  15, 16, 1,  11, 21,
+                               6,  7,  17, 2,  12, 22, 23, 8,  18,
+                               3,  13, 14, 24, 9,  19, 4};
+
+// Keccak-f[1600] permutation; theta and chi spelled out per row so the
+// compiler keeps the columns in registers
+inline void permute(uint64_t a[25]) {
+    for (int round = 0; round < 24; ++round) {
+        const uint64_t c0 = a[0] ^ a[5] ^ a[10] ^ a[15] ^ a[20];
+        const uint64_t c1 = a[1] ^ a[6] ^ a[11] ^ a[16] ^ a[21];
+        const uint64_t c2 = a[2] ^ a[7] ^ a[12] ^ a[17] ^ a[22];
+        const uint64_t c3 = a[3] ^ a[8] ^ a[13] ^ a[18] ^ a[23];
+        const uint64_t c4 = a[4] ^ a[9] ^ a[14] ^ a[19] ^ a[24];
+        const uint64_t d0 = c4 ^ rotl(c1, 1), d1 = c0 ^ rotl(c2, 1),
+                       d2 = c1 ^ rotl(c3, 1), d3 = c2 ^ rotl(c4, 1),
+                       d4 = c3 ^ rotl(c0, 1);
+        uint64_t b[25];
+#pragma GCC unroll 5
+        for (int y = 0; y < 25; y += 5) {
+            b[pi[y]] = rotl(a[y] ^ d0, rho[y]);
+            b[pi[y + 1]] = rotl(a[y + 1] ^ d1, rho[y + 1]);
+            b[pi[y + 2]] = rotl(a[y + 2] ^ d2, rho[y + 2]);
+            b[pi[y + 3]] = rotl(a[y + 3] ^ d3, rho[y + 3]);
+            b[pi[y + 4]] = rotl(a[y + 4] ^ d4, rho[y + 4]);
+        }
+#pragma GCC unroll 5
+        for (int y = 0; y < 25; y += 5) {
+            const uint64_t b0 = b[y], b1 = b[y + 1], b2 = b[y + 2],
+                           b3 = b[y + 3], b4 = b[y + 4];
+            a[y] = b0 ^ (~b1 & b2);
+            a[y + 1] = b1 ^ (~b2 & b3);
+            a[y + 2] = b2 ^ (~b3 & b4);
+            a[y + 3] = b3 ^ (~b4 & b0);
+            a[y + 4] = b4 ^ (~b0 & b1);
+        }
+        a[0] ^= round_constants[round];
+    }
+}
+
+inline uint64_t load_le64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, 8);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+inline void store_le64(uint8_t* p, uint64_t v) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    std::memcpy(p, &v, 8);
+}
+
+// Lane-parallel states: word i of message j sits in lane j of st[i]
+#if defined(__AVX2__)
+struct Lanes4 {
+    using V = __m256i;
+    static constexpr size_t n = 4;
+    static V zero() {
+        return _mm256_setzero_si256();
+    }
+    static V set1(uint64_t c) {
+        return _mm256_set1_epi64x(static_cast<long long>(c));
+    }
+    static V load(const uint64_t* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    static void store(uint64_t* p, V v) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    static V xor_(V a, V b) {
+        return _mm256_xor_si256(a, b);
+    }
+    // ~a & b
+    static V andnot(V a, V b) {
+        return _mm256_andnot_si256(a, b);
+    }
+    static V rotl(V v, int k) {
+        return _mm256_or_si256(_mm256_sll_epi64(v, _mm_cvtsi32_si128(k)),
+                               _mm256_srl_epi64(v, _mm_cvtsi32_si128(64 - k)));
+    }
+};
+#endif
+
+#if defined(__SSE2__)
+struct Lanes2 {
+    using V = __m128i;
+    static constexpr size_t n = 2;
+    static V zero() {
+        return _mm_setzero_si128();
+    }
+    static V set1(uint64_t c) {
+        return _mm_set1_epi64x(static_cast<long long>(c));
+    }
+    static V load(const uint64_t* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    static void store(uint64_t* p, V v) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+    static V xor_(V a, V b) {
+        return _mm_xor_si128(a, b);
+    }
+    static V andnot(V a, V b) {
+        return _mm_andnot_si128(a, b);
+    }
+    static V rotl(V v, int k) {
+        return _mm_or_si128(_mm_sll_epi64(v, _mm_cvtsi32_si128(k)),
+                            _mm_srl_epi64(v, _mm_cvtsi32_si128(64 - k)));
+    }
+};
+#endif
+
+// permute() on L::n states at once
+template <class L>
+inline void permute_lanes(typename L::V a[25]) {
+    using V = typename L::V;
+    for (int round = 0; round < 24; ++round) {
+        V c[5], d[5], b[25];
+#pragma GCC unroll 5
+        for (int x = 0; x < 5; ++x)
+            c[x] = L::xor_(L::xor_(L::xor_(a[x], a[x + 5]),
+                                   L::xor_(a[x + 10], a[x + 15])),
+                           a[x + 20]);
+        d[0] = L::xor_(c[4], L::rotl(c[1], 1));
+        d[1] = L::xor_(c[0], L::rotl(c[2], 1));
+        d[2] = L::xor_(c[1], L::rotl(c[3], 1));
+        d[3] = L::xor_(c[2], L::rotl(c[4], 1));
+        d[4] = L::xor_(c[3], L::rotl(c[0], 1));
+#pragma GCC unroll 5
+        for (int y = 0; y < 25; y += 5) {
+            b[pi[y]] = L::rotl(L::xor_(a[y], d[0]), rho[y]);
+            b[pi[y + 1]] = L::rotl(L::xor_(a[y + 1], d[1]), rho[y + 1]);
+            b[pi[y + 2]] = L::rotl(L::xor_(a[y + 2], d[2]), rho[y + 2]);
+            b[pi[y + 3]] = L::rotl(L::xor_(a[y + 3], d[3]), rho[y + 3]);
+            b[pi[y + 4]] = L::rotl(L::xor_(a[y + 4], d[4]), rho[y + 4]);
+        }
+#pragma GCC unroll 5
+        for (int y = 0; y < 25; y += 5) {
+            a[y] = L::xor_(b[y], L::andnot(b[y + 1], b[y + 2]));
+            a[y + 1] = L::xor_(b[y + 1], L::andnot(b[y + 2], b[y + 3]));
+            a[y + 2] = L::xor_(b[y + 2], L::andnot(b[y + 3], b[y + 4]));
+            a[y + 3] = L::xor_(b[y + 3], L::andnot(b[y + 4], b[y]));
+            a[y + 4] = L::xor_(b[y + 4], L::andnot(b[y], b[y + 1]));
+        }
+        a[0] = L::xor_(a[0], L::set1(round_constants[round]));
+    }
+}
+
+// Hash L::n messages of len bytes at data + j * stride into out + 32 * j
+template <class L>
+inline void keccak256_lanes(const uint8_t* data, size_t stride, size_t len,
+                            uint8_t* out) {
+    using V = typename L::V;
+    constexpr size_t rate = 136;
+    V st[25];
+    for (auto& v : st) v = L::zero();
+    uint64_t w[L::n];
+    size_t off = 0;
+    for (; len - off >= rate; off += rate) {
+        for (size_t i = 0; i < rate / 8; ++i) {
+            for (size_t j = 0; j < L::n; ++j)
+                w[j] = load_le64(data + j * stride + off + 8 * i);
+            st[i] = L::xor_(st[i], L::load(w));
+        }
+        permute_lanes<L>(st);
+    }
+    uint8_t block[L::n][rate] = {};
+    for (size_t j = 0; j < L::n; ++j) {
+        if (len > off)
+            std::memcpy(block[j], data + j * stride + off, len - off);
+        block[j][len - off] ^= 0x01;
+        block[j][rate - 1] ^= 0x80;
+    }
+    for (size_t i = 0; i < rate / 8; ++i) {
+        for (size_t j = 0; j < L::n; ++j) w[j] = load_le64(block[j] + 8 * i);
+        st[i] = L::xor_(st[i], L::load(w));
+    }
+    permute_lanes<L>(st);
+    for (size_t i = 0; i < 4; ++i) {
+        L::store(w, st[i]);
+        for (size_t j = 0; j < L::n; ++j)
+            store_le64(out + 32 * j + 8 * i, w[j]);
+    }
+}
+
+}  // namespace keccak_detail
+
+// Keccak-256 of [data, data + len) into out[32]
+inline void keccak256(const uint8_t* data, size_t len, uint8_t out[32]) {
+    constexpr size_t rate = 136;
+    uint64_t st[25] = {};
+    while (len >= rate) {
+        for (size_t i = 0; i < rate / 8; ++i)
+            st[i] ^= keccak_detail::load_le64(data + 8 * i);
+        keccak_detail::permute(st);
+        data += rate;
+        len -= rate;
+    }
+    uint8_t block[rate] = {};
+    if (len) std::memcpy(block, data, len);
+    block[len] ^= 0x01;
+    block[rate - 1] ^= 0x80;
+    for (size_t i = 0; i < rate / 8; ++i)
+        st[i] ^= keccak_detail::load_le64(block + 8 * i);
+    keccak_detail::permute(st);
+    for (size_t i = 0; i < 4; ++i) {
+        uint64_t v = st[i];
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        v = __builtin_bswap64(v);
+#endif
+        std::memcpy(out + 8 * i, &v, 8);
+    }
+}
+
+// count messages of len bytes each, message k at data + k * stride, hashed
+// into out + 32 * k. Runs four (AVX2) or two (SSE2) permutations in parallel.
+inline void keccak256_many(const uint8_t* data, size_t stride, size_t len,
+                           size_t count, uint8_t* out) {
+    size_t k = 0;
+#if defined(__AVX2__)
+    for (; k + 4 <= count; k += 4)
+        keccak_detail::keccak256_lanes<keccak_detail::Lanes4>(
+            data + k * stride, stride, len, out + 32 * k);
+#endif
+#if defined(__SSE2__)
+    for (; k + 2 <= count; k += 2)
+        keccak_detail::keccak256_lanes<keccak_detail::Lanes2>(
+            data + k * stride, stride, len, out + 32 * k);
+#endif
+    for (; k < count; ++k) keccak256(data + k * stride, len, out + 32 * k);
+}
+
+inline std::array<uint8_t, 32> keccak256(std::string_view s) {
+    std::array<uint8_t, 32> h;
+    keccak256(reinterpret_cast<const uint8_t*>(s.data()), s.size(), h.data());
+    return h;
+}
+
+// First four bytes of keccak256(signature), e.g. "balanceOf(address)"
+inline std::array<uint8_t, 4> selector_of(std::string_view signature) {
+    const auto h = keccak256(signature);
+    return {h[0], h[1], h[2], h[3]};
+}
+
+}  // namespace abi
@@ -0,0 +1,891 @@
+#pragma once
+
+#include "protocols.h"
+
+namespace abi {
+namespace multicall {
+
+// ----------------- zero-copy (bool,bytes)[] result view -----------------
+// aggregate3 / aggregate3Value / tryAggregate all return (bool,bytes)[].
+// ResultsView validates the whole response once in parse() and then hands
+// out (success, returnData) pairs that borrow from the response buffer, so
+// each entry can be decoded with its own Fn::decode_result and nothing is
+// copied into intermediate vectors.
+
+struct ResultRef {
+    bool success{false};
+    BytesSpan returnData;
+
+    // Decode returnData as the return value of function F
+    template <class F>
+    bool decode(typename F::return_t& out, Error* e = nullptr) const {
+        return F::decode_result(returnData, out, e);
+    }
+    // Same under decode limits, for returnData from untrusted targets
+    template <class F>
+    bool decode(typename F::return_t& out, const DecodeLimits& limits,
+                Error* e = nullptr) const {
+        return F::decode_result(returnData, out, limits, e);
+    }
+};
+
+struct ResultsView {
+    const uint8_t* body_{nullptr};  // start of the array body (after length)
+    size_t body_size_{0};
+    size_t size_{0};
+
+    // Validate a top-level encoded (bool,bytes)[] (as returned by eth_call)
+    static bool parse(BytesSpan in, ResultsView& out, Error* e = nullptr) {
+        size_t top = 0;
+        if (in.size() < 32 || !read_size_word(in.data(), top)) {
+            if (e) e->set(ErrorCode::short_input, "results: top short");
+            return false;
+        }
+        if (top > in.size() || in.size() - top < 32) {
+            if (e) e->set(ErrorCode::bad_offset, "results: top bad off");
+            return false;
+        }
+        if (!parse_array(BytesSpan(in.data() + top, in.size() - top), out,
+                         e)) {
+            if (e) e->shift(top);
+            return false;
+        }
+        return true;
+    }
+
+    // Validate an array encoding that starts at its length word
+    static bool parse_array(BytesSpan in, ResultsView& out,
+                            Error* e = nullptr) {
+        size_t len = 0;
+        if (in.size() < 32 || !read_size_word(in.data(), len)) {
+            if (e) e->set(ErrorCode::short_input, "results: len short");
+            return false;
+        }
+        const uint8_t* body = in.data() + 32;
+        const size_t body_size = in.size() - 32;
+        if (len > body_size / 32) {
+            if (e) e->set(ErrorCode::short_input, "results: offs short");
+            return false;
+        }
+        for (size_t i = 0; i < len; ++i) {
+            size_t off = 0, boff = 0, blen = 0;
+            if (!read_size_word(body + 32 * i, off) || off > body_size ||
+                body_size - off < 64) {
+                if (e) {
+                    e->set(ErrorCode::bad_offset, "results: bad off",
+                           32 + 32 * i);
+                    e->path.push_outer(uint32_t(i));
+                }
+                return false;
+            }
+            const uint8_t* elem = body + off;
+            const size_t elem_size = body_size - off;
+            if (!read_size_word(elem + 32, boff) || boff > elem_size ||
+                elem_size - boff < 32) {
+                if (e) {
+                    e->set(ErrorCode::bad_offset, "results: bad bytes off",
+                           64 + off);
+                    e->path.push_outer(uint32_t(i));
+                }
+                return false;
+            }
+            if (!read_size_word(elem + boff, blen) ||
+                blen > elem_size - boff - 32) {
+                if (e) {
+                    e->set(ErrorCode::out_of_range,
+                           "results: bytes len out of range", 32 + off + boff);
+                    e->path.push_outer(uint32_t(i));
+                }
+                return false;
+            }
+        }
+        out.body_ = body;
+        out.body_size_ = body_size;
+        out.size_ = len;
+        return true;
+    }
+
+    size_t size() const {
+        return size_;
+    }
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Entry i; offsets were validated by parse()
+    ResultRef operator[](size_t i) const {
+        size_t off = 0, boff = 0, blen = 0;
+        read_size_word(body_ + 32 * i, off);
+        const uint8_t* elem = body_ + off;
+        read_size_word(elem + 32, boff);
+        read_size_word(elem + boff, blen);
+        ResultRef r;
+        r.success = elem[31] != 0;
+        r.returnData = BytesSpan(elem + boff + 32, blen);
+        return r;
+    }
+
+    struct iterator {
+        const ResultsView* view{nullptr};
+        size_t i{0};
+        ResultRef operator*() const {
+            return (*view)[i];
+        }
+        iterator& operator++() {
+            ++i;
+            return *this;
+        }
+        bool operator==(const iterator& o) const {
+            return i == o.i;
+        }
+        bool operator!=(const iterator& o) const {
+            return i != o.i;
+        }
+    };
+    iterator begin() const {
+        return iterator{this, 0};
+    }
+    iterator end() const {
+        return iterator{this, size_};
+    }
+};
+
+// ----------------- typed call builder -----------------
+// A call bound to its target and arguments. Calldata is produced on demand
+// by F::encode_call straight into the aggregate buffer, so no per-call
+// std::vector<uint8_t> is ever built.
+template <class F, class... Args>
+struct Call {
+    using fn = F;
+    std::array<uint8_t, 20> target{};
+    bool allow_failure{true};  // only used by aggregate3
+    std::tuple<Args...> args;
+
+    size_t calldata_size() const {
+        return std::apply(
+            [](const Args&... vs) { return F::encoded_size(vs...); }, args);
+    }
+    // out must have room for calldata_size() bytes
+    void encode_calldata(uint8_t* out, size_t cap) const {
+        std::apply(
+            [&](const Args&... vs) {
+                F::template encode_call<Args...>(out, cap, vs...);
+            },
+            args);
+    }
+};
+
+template <class F, class... Args>
+inline Call<F, std::decay_t<Args>...> call(
+    const std::array<uint8_t, 20>& target, Args&&... args) {
+    return Call<F, std::decay_t<Args>...>{
+        target, true, std::make_tuple(std::forward<Args>(args)...)};
+}
+
+namespace detail {
+
+// aggregate3 elements are (address,bool,bytes); tryAggregate elements are
+// (address,bytes)
+inline size_t call_elem_bytes(bool with_flag, size_t calldata_len) {
+    return (with_flag ? 96 : 64) + 32 + pad32(calldata_len);
+}
+
+// for_each(f) must invoke f(call) on every call, in order
+template <class ForEach>
+inline size_t calls_array_size(bool with_flag, size_t n, ForEach&& for_each) {
+    size_t bytes = 32 + 32 * n;  // length + offsets
+    for_each([&](const auto& c) {
+        bytes += call_elem_bytes(with_flag, c.calldata_size());
+    });
+    return bytes;
+}
+
+// Write the array encoding (length word first) at out
+template <class ForEach>
+inline void write_calls_array(uint8_t* out, bool with_flag, size_t n,
+                              ForEach&& for_each) {
+    write_u256_imm(out, n);
+    uint8_t* offs = out + 32;
+    const size_t head = with_flag ? 96 : 64;
+    size_t running = 32 * n;
+    size_t i = 0;
+    for_each([&](const auto& c) {
+        write_u256_imm(offs + 32 * i, running);
+        uint8_t* el = offs + running;
+        std::memset(el, 0, 12);
+        std::memcpy(el + 12, c.target.data(), 20);
+        if (with_flag) {
+            std::memset(el + 32, 0, 32);
+            el[63] = c.allow_failure ? 1 : 0;
+        }
+        const size_t cd = c.calldata_size();
+        write_u256_imm(el + head - 32, head);
+        write_u256_imm(el + head, cd);
+        c.encode_calldata(el + head + 32, cd);
+        const size_t pad = pad32(cd) - cd;
+        if (pad) std::memset(el + head + 32 + cd, 0, pad);
+        running += call_elem_bytes(with_flag, cd);
+        ++i;
+    });
+}
+
+template <class ForEach>
+inline size_t aggregate3_size(size_t n, ForEach&& for_each) {
+    return 4 + 32 + calls_array_size(true, n, for_each);
+}
+
+// Unchecked writers: out must hold aggregate3_size / try_aggregate_size bytes
+template <class ForEach>
+inline void write_aggregate3(uint8_t* out, size_t n, ForEach&& for_each) {
+    std::memcpy(out, protocols::Sel_Multicall_aggregate3::value.data(), 4);
+    write_u256_imm(out + 4, 32);
+    write_calls_array(out + 4 + 32, true, n, for_each);
+}
+
+template <class ForEach>
+inline void write_try_aggregate(uint8_t* out, bool require_success, size_t n,
+                                ForEach&& for_each) {
+    std::memcpy(out, protocols::Sel_Multicall_tryAggregate::value.data(), 4);
+    std::memset(out + 4, 0, 32);
+    out[4 + 31] = require_success ? 1 : 0;
+    write_u256_imm(out + 4 + 32, 64);
+    write_calls_array(out + 4 + 64, false, n, for_each);
+}
+
+template <class ForEach>
+inline bool encode_aggregate3(uint8_t* out, size_t cap, size_t n,
+                              ForEach&& for_each) {
+    if (cap < aggregate3_size(n, for_each)) return false;
+    write_aggregate3(out, n, for_each);
+    return true;
+}
+
+template <class ForEach>
+inline size_t try_aggregate_size(size_t n, ForEach&& for_each) {
+    return 4 + 64 + calls_array_size(false, n, for_each);
+}
+
+template <class ForEach>
+inline bool encode_try_aggregate(uint8_t* out, size_t cap,
+                                 bool require_success, size_t n,
+                                 ForEach&& for_each) {
+    if (cap < try_aggregate_size(n, for_each)) return false;
+    write_try_aggregate(out, require_success, n, for_each);
+    return true;
+}
+
+// Pre-encoded Multicall3_Call / Multicall3_Call3 entries, viewed as calls
+struct RawCallRef {
+    const std::array<uint8_t, 20>& target;
+    bool allow_failure;
+    BytesSpan data;
+
+    size_t calldata_size() const {
+        return data.size();
+    }
+    void encode_calldata(uint8_t* out, size_t) const {
+        if (data.size()) std::memcpy(out, data.data(), data.size());
+    }
+};
+
+inline RawCallRef as_call(const protocols::Multicall3_Call3& c) {
+    return RawCallRef{c.target, c.allowFailure, as_bytes_span(c.callData)};
+}
+inline RawCallRef as_call(const protocols::Multicall3_Call& c) {
+    return RawCallRef{c.target, true, as_bytes_span(c.callData)};
+}
+template <class F, class... Args>
+inline const Call<F, Args...>& as_call(const Call<F, Args...>& c) {
+    return c;
+}
+
+}  // namespace detail
+
+// ----------------- zero-copy calldata view -----------------
+// The inverse of the builders above: CallsView validates multicall calldata
+// once and hands out the inner calls as spans into the input. Recognized
+// entry points are aggregate / blockAndAggregate ((address,bytes)[]),
+// tryAggregate / tryBlockAndAggregate (bool, (address,bytes)[]), aggregate3,
+// aggregate3Value, and the router-style self multicalls multicall(bytes[])
+// and multicall(uint256,bytes[]), whose entries call the same contract.
+
+// multicall(bytes[]) and multicall(uint256,bytes[]) as used by the Uniswap
+// V3 / Universal routers
+struct Sel_Router_multicall {
+    static constexpr std::array<uint8_t, 4> value{{0xac, 0x96, 0x50, 0xd8}};
+};
+struct Sel_Router_multicallDeadline {
+    static constexpr std::array<uint8_t, 4> value{{0x5a, 0xe4, 0x01, 0xdc}};
+};
+
+enum class CallsKind : uint8_t {
+    aggregate,         // (address,bytes)[]
+    try_aggregate,     // bool, (address,bytes)[]
+    aggregate3,        // (address,bool,bytes)[]
+    aggregate3_value,  // (address,bool,uint256,bytes)[]
+    self,              // bytes[] (target is the called contract)
+};
+
+struct CallRef {
+    BytesSpan target;           // 20 bytes; empty for CallsKind::self
+    bool allowFailure{false};   // aggregate3 / aggregate3Value only
+    BytesSpan value;            // aggregate3Value: 32-byte msg.value word
+    BytesSpan callData;
+
+    // True when callData targets function F
+    template <class F>
+    bool is() const {
+        return callData.size() >= 4 &&
+               std::memcmp(callData.data(), F::selector::value.data(), 4) == 0;
+    }
+    // Decode callData as a call to F
+    template <class F>
+    bool decode(typename F::args_t& out, Error* e = nullptr) const {
+        return F::decode_call(callData, out, e);
+    }
+};
+
+namespace detail {
+
+// Bytes before the callData offset word in one array element
+inline size_t calls_elem_head(CallsKind k) {
+    switch (k) {
+        case CallsKind::aggregate3:
+            return 64;
+        case CallsKind::aggregate3_value:
+            return 96;
+        case CallsKind::self:
+            return 0;
+        default:
+            return 32;
+    }
+}
+
+inline bool calls_kind_of(BytesSpan in, CallsKind& k, size_t& array_head) {
+    if (in.size() < 4) return false;
+    const uint8_t* s = in.data();
+    auto is = [&](const std::array<uint8_t, 4>& sel) {
+        return std::memcmp(s, sel.data(), 4) == 0;
+    };
+    array_head = 0;
+    if (is(protocols::Sel_Multicall_aggregate::value) ||
+        is(protocols::Sel_Multicall_blockAndAggregate::value)) {
+        k = CallsKind::aggregate;
+    } else if (is(protocols::Sel_Multicall_tryAggregate::value) ||
+               is(protocols::Sel_Multicall_tryBlockAndAggregate::value)) {
+        k = CallsKind::try_aggregate;
+        array_head = 32;
+    } else if (is(protocols::Sel_Multicall_aggregate3::value)) {
+        k = CallsKind::aggregate3;
+    } else if (is(protocols::Sel_Multicall_aggregate3Value::value)) {
+        k = CallsKind::aggregate3_value;
+    } else if (is(Sel_Router_multicall::value)) {
+        k = CallsKind::self;
+    } else if (is(Sel_Router_multicallDeadline::value)) {
+        k = CallsKind::self;
+        array_head = 32;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace detail
+
+struct CallsView {
+    CallsKind kind_{CallsKind::aggregate};
+    bool require_success_{false};   // tryAggregate flag
+    const uint8_t* body_{nullptr};  // start of the array body (after length)
+    size_t body_size_{0};
+    size_t size_{0};
+
+    // True when in starts with a recognized multicall selector
+    static bool is_multicall(BytesSpan in) {
+        CallsKind k;
+        size_t head;
+        return detail::calls_kind_of(in, k, head);
+    }
+
+    // Validate full calldata (selector included)
+    static bool parse(BytesSpan in, CallsView& out, Error* e = nullptr) {
+        size_t head = 0;
+        if (!detail::calls_kind_of(in, out.kind_, head)) {
+            if (e)
+                e->set(ErrorCode::selector_mismatch, "calls: not a multicall");
+            return false;
+        }
+        const BytesSpan args(in.data() + 4, in.size() - 4);
+        size_t top = 0;
+        if (args.size() < head + 32 ||
+            !read_size_word(args.data() + head, top)) {
+            if (e) e->set(ErrorCode::short_input, "calls: head short");
+            return false;
+        }
+        if (top > args.size() || args.size() - top < 32) {
+            if (e) e->set(ErrorCode::bad_offset, "calls: top bad off");
+            return false;
+        }
+        out.require_success_ =
+            out.kind_ == CallsKind::try_aggregate && args.data()[31] != 0;
+        if (!parse_array(BytesSpan(args.data() + top, args.size() - top),
+                         out.kind_, out, e)) {
+            if (e) e->shift(4 + top);
+            return false;
+        }
+        return true;
+    }
+
+    // Validate an array encoding that starts at its length word
+    static bool parse_array(BytesSpan in, CallsKind kind, CallsView& out,
+                            Error* e = nullptr) {
+        size_t len = 0;
+        if (in.size() < 32 || !read_size_word(in.data(), len)) {
+            if (e) e->set(ErrorCode::short_input, "calls: len short");
+            return false;
+        }
+        const uint8_t* body = in.data() + 32;
+        const size_t body_size = in.size() - 32;
+        if (len > body_size / 32) {
+            if (e) e->set(ErrorCode::short_input, "calls: offs short");
+            return false;
+        }
+        const size_t ehead = detail::calls_elem_head(kind);
+        for (size_t i = 0; i < len; ++i) {
+            size_t off = 0, boff = 0, blen = 0;
+            if (!read_size_word(body + 32 * i, off) || off > body_size ||
+                body_size - off < ehead + 32) {
+                if (e) {
+                    e->set(ErrorCode::bad_offset, "calls: bad off",
+                           32 + 32 * i);
+                    e->path.push_outer(uint32_t(i));
+                }
+                return false;
+            }
+            const uint8_t* elem = body + off;
+            const size_t elem_size = body_size - off;
+            if (kind == CallsKind::self) {
+                boff = 0;
+            } else if (!read_size_word(elem + ehead, boff) ||
+                       boff > elem_size || elem_size - boff < 32) {
+                if (e) {
+                    e->set(ErrorCode::bad_offset, "calls: bad bytes off",
+                           32 + off + ehead);
+                    e->path.push_outer(uint32_t(i));
+                }
+                return false;
+            }
+            if (!read_size_word(elem + boff, blen) ||
+                blen > elem_size - boff - 32) {
+                if (e) {
+                    e->set(ErrorCode::out_of_range,
+                           "calls: bytes len out of range", 32 + off + boff);
+                    e->path.push_outer(uint32_t(i));
+                }
+                return false;
+            }
+        }
+        out.kind_ = kind;
+        out.body_ = body;
+        out.body_size_ = body_size;
+        out.size_ = len;
+        return true;
+    }
+
+    CallsKind kind() const {
+        return kind_;
+    }
+    bool require_success() const {
+        return require_success_;
+    }
+    size_t size() const {
+        return size_;
+    }
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Entry i; offsets were validated by parse()
+    CallRef operator[](size_t i) const {
+        size_t off = 0, boff = 0, blen = 0;
+        read_size_word(body_ + 32 * i, off);
+        const uint8_t* elem = body_ + off;
+        CallRef c;
+        if (kind_ != CallsKind::self) {
+            c.target = BytesSpan(elem + 12, 20);
+            read_size_word(elem + detail::calls_elem_head(kind_), boff);
+        }
+        if (kind_ == CallsKind::aggregate3 ||
+            kind_ == CallsKind::aggregate3_value)
+            c.allowFailure = elem[63] != 0;
+        if (kind_ == CallsKind::aggregate3_value)
+            c.value = BytesSpan(elem + 64, 32);
+        read_size_word(elem + boff, blen);
+        c.callData = BytesSpan(elem + boff + 32, blen);
+        return c;
+    }
+
+    struct iterator {
+        const CallsView* view{nullptr};
+        size_t i{0};
+        CallRef operator*() const {
+            return (*view)[i];
+        }
+        iterator& operator++() {
+            ++i;
+            return *this;
+        }
+        bool operator==(const iterator& o) const {
+            return i == o.i;
+        }
+        bool operator!=(const iterator& o) const {
+            return i != o.i;
+        }
+    };
+    iterator begin() const {
+        return iterator{this, 0};
+    }
+    iterator end() const {
+        return iterator{this, size_};
+    }
+};
+
+namespace detail {
+
+template <class F>
+inline bool unwrap_calls(const CallsView& view, BytesSpan target,
+                         size_t depth, size_t max_depth, F& fn, Error* e) {
+    for (CallRef c : view) {
+        if (view.kind() == CallsKind::self) c.target = target;
+        if (depth + 1 < max_depth && CallsView::is_multicall(c.callData)) {
+            CallsView inner;
+            if (!CallsView::parse(c.callData, inner, e) ||
+                !unwrap_calls(inner, c.target, depth + 1, max_depth, fn, e))
+                return false;
+        } else if (!fn(static_cast<const CallRef&>(c), depth)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace detail
+
+// Visit the leaf calls of multicall calldata, descending into nested
+// multicalls (aggregate* inside aggregate*, router multicall(bytes[]) inside
+// aggregate3, ...) up to max_depth levels; deeper multicalls are reported as
+// leaves. fn(const CallRef&, size_t depth) returns false to stop. Entries of
+// a self multicall inherit the target of the enclosing call (empty at the
+// top level unless given). Returns false on malformed input (e->message set)
+// or when fn stopped the walk.
+template <class F>
+inline bool for_each_call(BytesSpan calldata, F&& fn, size_t max_depth = 4,
+                          Error* e = nullptr, BytesSpan target = {}) {
+    CallsView view;
+    if (!CallsView::parse(calldata, view, e)) return false;
+    return detail::unwrap_calls(view, target, 0, max_depth, fn, e);
+}
+
+// ----------------- chunk planner -----------------
+// Splits a long call list into several aggregate payloads so that no single
+// eth_call exceeds node limits. Calldata sizes are exact (identical to
+// Fn::encoded_size of the chunk); response sizes are estimates.
+
+struct ChunkLimits {
+    size_t max_calldata_bytes{128 * 1024};  // per payload, incl. selector
+    size_t max_return_bytes{1024 * 1024};   // estimated response per payload
+    size_t max_calls{0};                    // 0 = unlimited
+    // returnData estimate for calls whose return type is unknown or dynamic
+    size_t return_bytes_per_call{32};
+};
+
+struct Chunk {
+    size_t first{0};          // index of the first call
+    size_t count{0};          // number of calls
+    size_t offset{0};         // byte offset of the payload in the output
+    size_t calldata_size{0};  // exact payload size
+    size_t return_size{0};    // estimated response size
+};
+
+struct ChunkPlan {
+    std::vector<Chunk> chunks;
+    size_t total_size{0};  // all payloads packed back to back
+
+    BytesSpan payload(const uint8_t* out, size_t i) const {
+        return BytesSpan(out + chunks[i].offset, chunks[i].calldata_size);
+    }
+};
+
+namespace detail {
+
+template <class T>
+inline size_t return_estimate(const T&, const ChunkLimits& lim) {
+    return lim.return_bytes_per_call;
+}
+template <class F, class... Args>
+inline size_t return_estimate(const Call<F, Args...>&,
+                              const ChunkLimits& lim) {
+    using R = typename F::return_schema;
+    if constexpr (!traits<R>::is_dynamic) {
+        return 32 * traits<R>::head_words;
+    } else {
+        return lim.return_bytes_per_call;
+    }
+}
+
+template <class Range>
+inline bool plan_chunks(const Range& calls, bool with_flag,
+                        size_t fixed_bytes, const ChunkLimits& lim,
+                        ChunkPlan& plan, Error* e) {
+    plan.chunks.clear();
+    plan.total_size = 0;
+    constexpr size_t resp_fixed = 64;  // top offset + length
+    Chunk cur;
+    cur.calldata_size = fixed_bytes;
+    cur.return_size = resp_fixed;
+
+    auto flush = [&](size_t next) {
+        cur.offset = plan.total_size;
+        plan.total_size += cur.calldata_size;
+        plan.chunks.push_back(cur);
+        cur = Chunk{};
+        cur.first = next;
+        cur.calldata_size = fixed_bytes;
+        cur.return_size = resp_fixed;
+    };
+
+    size_t i = 0;
+    for (const auto& c : calls) {
+        // offset word + element; response: offset word + (bool,bytes)
+        const size_t cd =
+            32 + call_elem_bytes(with_flag, as_call(c).calldata_size());
+        const size_t rd = 32 + 96 + pad32(return_estimate(c, lim));
+        if (fixed_bytes + cd > lim.max_calldata_bytes ||
+            resp_fixed + rd > lim.max_return_bytes) {
+            if (e)
+                e->set(ErrorCode::limit_exceeded,
+                       "multicall: call exceeds chunk limits");
+            return false;
+        }
+        if (cur.count &&
+            (cur.calldata_size + cd > lim.max_calldata_bytes ||
+             cur.return_size + rd > lim.max_return_bytes ||
+             (lim.max_calls && cur.count == lim.max_calls))) {
+            flush(i);
+        }
+        ++cur.count;
+        cur.calldata_size += cd;
+        cur.return_size += rd;
+        ++i;
+    }
+    if (cur.count) flush(i);
+    return true;
+}
+
+template <class Range>
+inline auto chunk_each(const Range& calls, const Chunk& ch) {
+    auto b = std::begin(calls) + ch.first;
+    return [b, n = ch.count](auto&& f) {
+        for (size_t k = 0; k < n; ++k) f(as_call(b[k]));
+    };
+}
+
+}  // namespace detail
+
+// calls: random-access range of Multicall3_Call3 or multicall::Call<Fn, ...>
+template <class Range>
+inline bool plan_aggregate3(const Range& calls, const ChunkLimits& lim,
+                            ChunkPlan& plan, Error* e = nullptr) {
+    return detail::plan_chunks(calls, true, 4 + 32 + 32, lim, plan, e);
+}
+
+// calls: random-access range of Multicall3_Call or multicall::Call<Fn, ...>
+template <class Range>
+inline bool plan_try_aggregate(const Range& calls, const ChunkLimits& lim,
+                               ChunkPlan& plan, Error* e = nullptr) {
+    return detail::plan_chunks(calls, false, 4 + 64 + 32, lim, plan, e);
+}
+
+// Write every planned aggregate3 payload into out (plan.total_size bytes)
+template <class Range>
+inline bool encode_aggregate3_chunks(uint8_t* out, size_t cap,
+                                     const Range& calls,
+                                     const ChunkPlan& plan,
+                                     Error* e = nullptr) {
+    if (cap < plan.total_size) {
+        if (e)
+            e->set(ErrorCode::buffer_too_small,
+                   "encode_chunks: buffer too small");
+        return false;
+    }
+    for (const Chunk& ch : plan.chunks) {
+        detail::write_aggregate3(out + ch.offset, ch.count,
+                                 detail::chunk_each(calls, ch));
+    }
+    return true;
+}
+
+// Write every planned tryAggregate payload into out (plan.total_size bytes)
+template <class Range>
+inline bool encode_try_aggregate_chunks(uint8_t* out, size_t cap,
+                                        bool require_success,
+                                        const Range& calls,
+                                        const ChunkPlan& plan,
+                                        Error* e = nullptr) {
+    if (cap < plan.total_size) {
+        if (e)
+            e->set(ErrorCode::buffer_too_small,
+                   "encode_chunks: buffer too small");
+        return false;
+    }
+    for (const Chunk& ch : plan.chunks) {
+        detail::write_try_aggregate(out + ch.offset, require_success, ch.count,
+                                    detail::chunk_each(calls, ch));
+    }
+    return true;
+}
+
+}  // namespace multicall
+
+// ----------------- Multicall<Fn1, Fn2, ...> -----------------
+// Heterogeneous batch: one typed call per Fn, encoded into a single
+// aggregate3/tryAggregate buffer and decoded back into a tuple of typed
+// results. success[i] is true only when call i succeeded on-chain AND its
+// returnData decoded as Fn_i::return_t.
+template <class... Fns>
+struct Multicall {
+    static constexpr size_t size = sizeof...(Fns);
+
+    struct Results {
+        std::array<bool, sizeof...(Fns)> success{};
+        std::tuple<typename Fns::return_t...> values;
+    };
+
+    template <class... Calls>
+    static size_t encoded_size_aggregate3(const Calls&... calls) {
+        check_calls<Calls...>();
+        return multicall::detail::aggregate3_size(size, each(calls...));
+    }
+    template <class... Calls>
+    static bool encode_aggregate3(uint8_t* out, size_t cap,
+                                  const Calls&... calls) {
+        check_calls<Calls...>();
+        return multicall::detail::encode_aggregate3(out, cap, size,
+                                                    each(calls...));
+    }
+
+    template <class... Calls>
+    static size_t encoded_size_try_aggregate(const Calls&... calls) {
+        check_calls<Calls...>();
+        return multicall::detail::try_aggregate_size(size, each(calls...));
+    }
+    template <class... Calls>
+    static bool encode_try_aggregate(uint8_t* out, size_t cap,
+                                     bool require_success,
+                                     const Calls&... calls) {
+        check_calls<Calls...>();
+        return multicall::detail::encode_try_aggregate(
+            out, cap, require_success, size, each(calls...));
+    }
+
+    // Decode an aggregate3 / tryAggregate response
+    static bool decode(BytesSpan in, Results& out, Error* e = nullptr) {
+        multicall::ResultsView view;
+        if (!multicall::ResultsView::parse(in, view, e)) return false;
+        if (view.size() != size) {
+            if (e) e->set(ErrorCode::other, "multicall: result count mismatch");
+            return false;
+        }
+        decode_impl(view, out, std::index_sequence_for<Fns...>{});
+        return true;
+    }
+
+   private:
+    template <class... Calls>
+    static constexpr void check_calls() {
+        static_assert(sizeof...(Calls) == sizeof...(Fns), "arity mismatch");
+        static_assert(
+            (std::is_same<typename Calls::fn, Fns>::value && ... && true),
+            "call/Fn mismatch");
+    }
+
+    template <class... Calls>
+    static auto each(const Calls&... calls) {
+        return [&calls...](auto&& f) { (f(calls), ...); };
+    }
+
+    template <size_t... I>
+    static void decode_impl(const multicall::ResultsView& view, Results& out,
+                            std::index_sequence<I...>) {
+        (([&] {
+             using F = typename std::tuple_element<I, std::tuple<Fns...>>::type;
+             const multicall::ResultRef r = view[I];
+             out.success[I] =
+                 r.success && r.template decode<F>(std::get<I>(out.values));
+         }()),
+         ...);
+    }
+};
+
+// ----------------- MulticallBatch<Fn> -----------------
+// Runtime-sized variant for N calls of the same function. calls is any
+// range of multicall::Call<Fn, ...> with size().
+template <class F>
+struct MulticallBatch {
+    struct Results {
+        std::vector<bool> success;
+        std::vector<typename F::return_t> values;
+    };
+
+    template <class Range>
+    static size_t encoded_size_aggregate3(const Range& calls) {
+        return multicall::detail::aggregate3_size(calls.size(), each(calls));
+    }
+    template <class Range>
+    static bool encode_aggregate3(uint8_t* out, size_t cap,
+                                  const Range& calls) {
+        return multicall::detail::encode_aggregate3(out, cap, calls.size(),
+                                                    each(calls));
+    }
+
+    template <class Range>
+    static size_t encoded_size_try_aggregate(const Range& calls) {
+        return multicall::detail::try_aggregate_size(calls.size(),
+                                                     each(calls));
+    }
+    template <class Range>
+    static bool encode_try_aggregate(uint8_t* out, size_t cap,
+                                     bool require_success,
+                                     const Range& calls) {
+        return multicall::detail::encode_try_aggregate(
+            out, cap, require_success, calls.size(), each(calls));
+    }
+
+    // Decode an aggregate3 / tryAggregate response; out keeps its capacity
+    static bool decode(BytesSpan in, Results& out, Error* e = nullptr) {
+        multicall::ResultsView view;
+        if (!multicall::ResultsView::parse(in, view, e)) return false;
+        out.success.resize(view.size());
+        out.values.resize(view.size());
+        for (size_t i = 0; i < view.size(); ++i) {
+            const multicall::ResultRef r = view[i];
+            out.success[i] = r.success && r.template decode<F>(out.values[i]);
+        }
+        return true;
+    }
+
+   private:
+    template <class Range>
+    static auto each(const Range& calls) {
+        return [&calls](auto&& f) {
+            for (const auto& c : calls) {
+                static_assert(
+                    std::is_same<typename std::decay_t<decltype(c)>::fn,
+                                 F>::value,
+                    "call/Fn mismatch");
+                f(c);
+            }
+        };
+    }
+};
+
+}  // namespace abi
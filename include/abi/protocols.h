@@ -22,6 +22,7 @@ struct ITickLens_PopulatedTick {
   // Underlying ABI schema
   using schema = abi::tuple<int_t<24>, int_t<128>, uint_t<128>>;
   using values = std::tuple<abi::cpp_t<int_t<24>>, abi::cpp_t<int_t<128>>, abi::cpp_t<uint_t<128>>>;
+  static constexpr std::array<const char*, 3> field_names{{"tick", "liquidityNet", "liquidityGross"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const ITickLens_PopulatedTick& s) {
@@ -32,6 +33,14 @@ struct ITickLens_PopulatedTick {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const ITickLens_PopulatedTick& s) {
+    return std::tie(s.tick, s.liquidityNet, s.liquidityGross);
+  }
+  static auto tie(ITickLens_PopulatedTick& s) {
+    return std::tie(s.tick, s.liquidityNet, s.liquidityGross);
+  }
+
   // Conversion from underlying tuple values
   static ITickLens_PopulatedTick from_tuple(const values& t) {
     ITickLens_PopulatedTick s{};
@@ -50,6 +59,7 @@ struct Multicall3_Call {
   // Underlying ABI schema
   using schema = abi::tuple<address20, bytes>;
   using values = std::tuple<abi::cpp_t<address20>, abi::cpp_t<bytes>>;
+  static constexpr std::array<const char*, 2> field_names{{"target", "callData"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const Multicall3_Call& s) {
@@ -59,6 +69,14 @@ struct Multicall3_Call {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const Multicall3_Call& s) {
+    return std::tie(s.target, s.callData);
+  }
+  static auto tie(Multicall3_Call& s) {
+    return std::tie(s.target, s.callData);
+  }
+
   // Conversion from underlying tuple values
   static Multicall3_Call from_tuple(const values& t) {
     Multicall3_Call s{};
@@ -77,6 +95,7 @@ struct Multicall3_Call3 {
   // Underlying ABI schema
   using schema = abi::tuple<address20, bool_t, bytes>;
   using values = std::tuple<abi::cpp_t<address20>, abi::cpp_t<bool_t>, abi::cpp_t<bytes>>;
+  static constexpr std::array<const char*, 3> field_names{{"target", "allowFailure", "callData"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const Multicall3_Call3& s) {
@@ -87,6 +106,14 @@ struct Multicall3_Call3 {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const Multicall3_Call3& s) {
+    return std::tie(s.target, s.allowFailure, s.callData);
+  }
+  static auto tie(Multicall3_Call3& s) {
+    return std::tie(s.target, s.allowFailure, s.callData);
+  }
+
   // Conversion from underlying tuple values
   static Multicall3_Call3 from_tuple(const values& t) {
     Multicall3_Call3 s{};
@@ -105,6 +132,7 @@ struct Multicall3_Result {
   // Underlying ABI schema
   using schema = abi::tuple<bool_t, bytes>;
   using values = std::tuple<abi::cpp_t<bool_t>, abi::cpp_t<bytes>>;
+  static constexpr std::array<const char*, 2> field_names{{"success", "returnData"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const Multicall3_Result& s) {
@@ -114,6 +142,14 @@ struct Multicall3_Result {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const Multicall3_Result& s) {
+    return std::tie(s.success, s.returnData);
+  }
+  static auto tie(Multicall3_Result& s) {
+    return std::tie(s.success, s.returnData);
+  }
+
   // Conversion from underlying tuple values
   static Multicall3_Result from_tuple(const values& t) {
     Multicall3_Result s{};
@@ -133,6 +169,7 @@ struct Multicall3_Call3Value {
   // Underlying ABI schema
   using schema = abi::tuple<address20, bool_t, uint_t<256>, bytes>;
   using values = std::tuple<abi::cpp_t<address20>, abi::cpp_t<bool_t>, abi::cpp_t<uint_t<256>>, abi::cpp_t<bytes>>;
+  static constexpr std::array<const char*, 4> field_names{{"target", "allowFailure", "value", "callData"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const Multicall3_Call3Value& s) {
@@ -144,6 +181,14 @@ struct Multicall3_Call3Value {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const Multicall3_Call3Value& s) {
+    return std::tie(s.target, s.allowFailure, s.value, s.callData);
+  }
+  static auto tie(Multicall3_Call3Value& s) {
+    return std::tie(s.target, s.allowFailure, s.value, s.callData);
+  }
+
   // Conversion from underlying tuple values
   static Multicall3_Call3Value from_tuple(const values& t) {
     Multicall3_Call3Value s{};
@@ -162,6 +207,7 @@ struct ERC20_TransferEventData {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<256>>;
   using values = std::tuple<abi::cpp_t<uint_t<256>>>;
+  static constexpr std::array<const char*, 1> field_names{{"value"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const ERC20_TransferEventData& s) {
@@ -170,6 +216,14 @@ struct ERC20_TransferEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const ERC20_TransferEventData& s) {
+    return std::tie(s.value);
+  }
+  static auto tie(ERC20_TransferEventData& s) {
+    return std::tie(s.value);
+  }
+
   // Conversion from underlying tuple values
   static ERC20_TransferEventData from_tuple(const values& t) {
     ERC20_TransferEventData s{};
@@ -185,6 +239,7 @@ struct ERC20_ApprovalEventData {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<256>>;
   using values = std::tuple<abi::cpp_t<uint_t<256>>>;
+  static constexpr std::array<const char*, 1> field_names{{"value"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const ERC20_ApprovalEventData& s) {
@@ -193,6 +248,14 @@ struct ERC20_ApprovalEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const ERC20_ApprovalEventData& s) {
+    return std::tie(s.value);
+  }
+  static auto tie(ERC20_ApprovalEventData& s) {
+    return std::tie(s.value);
+  }
+
   // Conversion from underlying tuple values
   static ERC20_ApprovalEventData from_tuple(const values& t) {
     ERC20_ApprovalEventData s{};
@@ -210,6 +273,7 @@ struct UniswapV3Pool_BurnEventData {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<128>, uint_t<256>, uint_t<256>>;
   using values = std::tuple<abi::cpp_t<uint_t<128>>, abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>>;
+  static constexpr std::array<const char*, 3> field_names{{"amount", "amount0", "amount1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const UniswapV3Pool_BurnEventData& s) {
@@ -220,6 +284,14 @@ struct UniswapV3Pool_BurnEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const UniswapV3Pool_BurnEventData& s) {
+    return std::tie(s.amount, s.amount0, s.amount1);
+  }
+  static auto tie(UniswapV3Pool_BurnEventData& s) {
+    return std::tie(s.amount, s.amount0, s.amount1);
+  }
+
   // Conversion from underlying tuple values
   static UniswapV3Pool_BurnEventData from_tuple(const values& t) {
     UniswapV3Pool_BurnEventData s{};
@@ -239,6 +311,7 @@ struct UniswapV3Pool_CollectEventData {
   // Underlying ABI schema
   using schema = abi::tuple<address20, uint_t<128>, uint_t<128>>;
   using values = std::tuple<abi::cpp_t<address20>, abi::cpp_t<uint_t<128>>, abi::cpp_t<uint_t<128>>>;
+  static constexpr std::array<const char*, 3> field_names{{"recipient", "amount0", "amount1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const UniswapV3Pool_CollectEventData& s) {
@@ -249,6 +322,14 @@ struct UniswapV3Pool_CollectEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const UniswapV3Pool_CollectEventData& s) {
+    return std::tie(s.recipient, s.amount0, s.amount1);
+  }
+  static auto tie(UniswapV3Pool_CollectEventData& s) {
+    return std::tie(s.recipient, s.amount0, s.amount1);
+  }
+
   // Conversion from underlying tuple values
   static UniswapV3Pool_CollectEventData from_tuple(const values& t) {
     UniswapV3Pool_CollectEventData s{};
@@ -267,6 +348,7 @@ struct UniswapV3Pool_CollectProtocolEventData {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<128>, uint_t<128>>;
   using values = std::tuple<abi::cpp_t<uint_t<128>>, abi::cpp_t<uint_t<128>>>;
+  static constexpr std::array<const char*, 2> field_names{{"amount0", "amount1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const UniswapV3Pool_CollectProtocolEventData& s) {
@@ -276,6 +358,14 @@ struct UniswapV3Pool_CollectProtocolEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const UniswapV3Pool_CollectProtocolEventData& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+  static auto tie(UniswapV3Pool_CollectProtocolEventData& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+
   // Conversion from underlying tuple values
   static UniswapV3Pool_CollectProtocolEventData from_tuple(const values& t) {
     UniswapV3Pool_CollectProtocolEventData s{};
@@ -295,6 +385,7 @@ struct UniswapV3Pool_FlashEventData {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<256>, uint_t<256>, uint_t<256>, uint_t<256>>;
   using values = std::tuple<abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>>;
+  static constexpr std::array<const char*, 4> field_names{{"amount0", "amount1", "paid0", "paid1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const UniswapV3Pool_FlashEventData& s) {
@@ -306,6 +397,14 @@ struct UniswapV3Pool_FlashEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const UniswapV3Pool_FlashEventData& s) {
+    return std::tie(s.amount0, s.amount1, s.paid0, s.paid1);
+  }
+  static auto tie(UniswapV3Pool_FlashEventData& s) {
+    return std::tie(s.amount0, s.amount1, s.paid0, s.paid1);
+  }
+
   // Conversion from underlying tuple values
   static UniswapV3Pool_FlashEventData from_tuple(const values& t) {
     UniswapV3Pool_FlashEventData s{};
@@ -325,6 +424,7 @@ struct UniswapV3Pool_IncreaseObservationCardinalityNextEventData {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<16>, uint_t<16>>;
   using values = std::tuple<abi::cpp_t<uint_t<16>>, abi::cpp_t<uint_t<16>>>;
+  static constexpr std::array<const char*, 2> field_names{{"observationCardinalityNextOld", "observationCardinalityNextNew"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const UniswapV3Pool_IncreaseObservationCardinalityNextEventData& s) {
@@ -334,6 +434,14 @@ struct UniswapV3Pool_IncreaseObservationCardinalityNextEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const UniswapV3Pool_IncreaseObservationCardinalityNextEventData& s) {
+    return std::tie(s.observationCardinalityNextOld, s.observationCardinalityNextNew);
+  }
+  static auto tie(UniswapV3Pool_IncreaseObservationCardinalityNextEventData& s) {
+    return std::tie(s.observationCardinalityNextOld, s.observationCardinalityNextNew);
+  }
+
   // Conversion from underlying tuple values
   static UniswapV3Pool_IncreaseObservationCardinalityNextEventData from_tuple(const values& t) {
     UniswapV3Pool_IncreaseObservationCardinalityNextEventData s{};
@@ -351,6 +459,7 @@ struct UniswapV3Pool_InitializeEventData {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<160>, int_t<24>>;
   using values = std::tuple<abi::cpp_t<uint_t<160>>, abi::cpp_t<int_t<24>>>;
+  static constexpr std::array<const char*, 2> field_names{{"sqrtPriceX96", "tick"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const UniswapV3Pool_InitializeEventData& s) {
@@ -360,6 +469,14 @@ struct UniswapV3Pool_InitializeEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const UniswapV3Pool_InitializeEventData& s) {
+    return std::tie(s.sqrtPriceX96, s.tick);
+  }
+  static auto tie(UniswapV3Pool_InitializeEventData& s) {
+    return std::tie(s.sqrtPriceX96, s.tick);
+  }
+
   // Conversion from underlying tuple values
   static UniswapV3Pool_InitializeEventData from_tuple(const values& t) {
     UniswapV3Pool_InitializeEventData s{};
@@ -379,6 +496,7 @@ struct UniswapV3Pool_MintEventData {
   // Underlying ABI schema
   using schema = abi::tuple<address20, uint_t<128>, uint_t<256>, uint_t<256>>;
   using values = std::tuple<abi::cpp_t<address20>, abi::cpp_t<uint_t<128>>, abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>>;
+  static constexpr std::array<const char*, 4> field_names{{"sender", "amount", "amount0", "amount1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const UniswapV3Pool_MintEventData& s) {
@@ -390,6 +508,14 @@ struct UniswapV3Pool_MintEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const UniswapV3Pool_MintEventData& s) {
+    return std::tie(s.sender, s.amount, s.amount0, s.amount1);
+  }
+  static auto tie(UniswapV3Pool_MintEventData& s) {
+    return std::tie(s.sender, s.amount, s.amount0, s.amount1);
+  }
+
   // Conversion from underlying tuple values
   static UniswapV3Pool_MintEventData from_tuple(const values& t) {
     UniswapV3Pool_MintEventData s{};
@@ -411,6 +537,7 @@ struct UniswapV3Pool_SetFeeProtocolEventData {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<8>, uint_t<8>, uint_t<8>, uint_t<8>>;
   using values = std::tuple<abi::cpp_t<uint_t<8>>, abi::cpp_t<uint_t<8>>, abi::cpp_t<uint_t<8>>, abi::cpp_t<uint_t<8>>>;
+  static constexpr std::array<const char*, 4> field_names{{"feeProtocol0Old", "feeProtocol1Old", "feeProtocol0New", "feeProtocol1New"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const UniswapV3Pool_SetFeeProtocolEventData& s) {
@@ -422,6 +549,14 @@ struct UniswapV3Pool_SetFeeProtocolEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const UniswapV3Pool_SetFeeProtocolEventData& s) {
+    return std::tie(s.feeProtocol0Old, s.feeProtocol1Old, s.feeProtocol0New, s.feeProtocol1New);
+  }
+  static auto tie(UniswapV3Pool_SetFeeProtocolEventData& s) {
+    return std::tie(s.feeProtocol0Old, s.feeProtocol1Old, s.feeProtocol0New, s.feeProtocol1New);
+  }
+
   // Conversion from underlying tuple values
   static UniswapV3Pool_SetFeeProtocolEventData from_tuple(const values& t) {
     UniswapV3Pool_SetFeeProtocolEventData s{};
@@ -444,6 +579,7 @@ struct UniswapV3Pool_SwapEventData {
   // Underlying ABI schema
   using schema = abi::tuple<int_t<256>, int_t<256>, uint_t<160>, uint_t<128>, int_t<24>>;
   using values = std::tuple<abi::cpp_t<int_t<256>>, abi::cpp_t<int_t<256>>, abi::cpp_t<uint_t<160>>, abi::cpp_t<uint_t<128>>, abi::cpp_t<int_t<24>>>;
+  static constexpr std::array<const char*, 5> field_names{{"amount0", "amount1", "sqrtPriceX96", "liquidity", "tick"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const UniswapV3Pool_SwapEventData& s) {
@@ -456,6 +592,14 @@ struct UniswapV3Pool_SwapEventData {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const UniswapV3Pool_SwapEventData& s) {
+    return std::tie(s.amount0, s.amount1, s.sqrtPriceX96, s.liquidity, s.tick);
+  }
+  static auto tie(UniswapV3Pool_SwapEventData& s) {
+    return std::tie(s.amount0, s.amount1, s.sqrtPriceX96, s.liquidity, s.tick);
+  }
+
   // Conversion from underlying tuple values
   static UniswapV3Pool_SwapEventData from_tuple(const values& t) {
     UniswapV3Pool_SwapEventData s{};
@@ -476,6 +620,7 @@ struct IUniswapV3Pool_Burn {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<256>, uint_t<256>>;
   using values = std::tuple<abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>>;
+  static constexpr std::array<const char*, 2> field_names{{"amount0", "amount1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_Burn& s) {
@@ -485,6 +630,14 @@ struct IUniswapV3Pool_Burn {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_Burn& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+  static auto tie(IUniswapV3Pool_Burn& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_Burn from_tuple(const values& t) {
     IUniswapV3Pool_Burn s{};
@@ -502,6 +655,7 @@ struct IUniswapV3Pool_Collect {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<128>, uint_t<128>>;
   using values = std::tuple<abi::cpp_t<uint_t<128>>, abi::cpp_t<uint_t<128>>>;
+  static constexpr std::array<const char*, 2> field_names{{"amount0", "amount1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_Collect& s) {
@@ -511,6 +665,14 @@ struct IUniswapV3Pool_Collect {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_Collect& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+  static auto tie(IUniswapV3Pool_Collect& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_Collect from_tuple(const values& t) {
     IUniswapV3Pool_Collect s{};
@@ -528,6 +690,7 @@ struct IUniswapV3Pool_CollectProtocol {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<128>, uint_t<128>>;
   using values = std::tuple<abi::cpp_t<uint_t<128>>, abi::cpp_t<uint_t<128>>>;
+  static constexpr std::array<const char*, 2> field_names{{"amount0", "amount1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_CollectProtocol& s) {
@@ -537,6 +700,14 @@ struct IUniswapV3Pool_CollectProtocol {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_CollectProtocol& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+  static auto tie(IUniswapV3Pool_CollectProtocol& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_CollectProtocol from_tuple(const values& t) {
     IUniswapV3Pool_CollectProtocol s{};
@@ -554,6 +725,7 @@ struct IUniswapV3Pool_Mint {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<256>, uint_t<256>>;
   using values = std::tuple<abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>>;
+  static constexpr std::array<const char*, 2> field_names{{"amount0", "amount1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_Mint& s) {
@@ -563,6 +735,14 @@ struct IUniswapV3Pool_Mint {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_Mint& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+  static auto tie(IUniswapV3Pool_Mint& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_Mint from_tuple(const values& t) {
     IUniswapV3Pool_Mint s{};
@@ -582,6 +762,7 @@ struct IUniswapV3Pool_Observations {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<32>, int_t<56>, uint_t<160>, bool_t>;
   using values = std::tuple<abi::cpp_t<uint_t<32>>, abi::cpp_t<int_t<56>>, abi::cpp_t<uint_t<160>>, abi::cpp_t<bool_t>>;
+  static constexpr std::array<const char*, 4> field_names{{"blockTimestamp", "tickCumulative", "secondsPerLiquidityCumulativeX128", "initialized"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_Observations& s) {
@@ -593,6 +774,14 @@ struct IUniswapV3Pool_Observations {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_Observations& s) {
+    return std::tie(s.blockTimestamp, s.tickCumulative, s.secondsPerLiquidityCumulativeX128, s.initialized);
+  }
+  static auto tie(IUniswapV3Pool_Observations& s) {
+    return std::tie(s.blockTimestamp, s.tickCumulative, s.secondsPerLiquidityCumulativeX128, s.initialized);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_Observations from_tuple(const values& t) {
     IUniswapV3Pool_Observations s{};
@@ -612,6 +801,7 @@ struct IUniswapV3Pool_Observe {
   // Underlying ABI schema
   using schema = abi::tuple<dyn_array<int_t<56>>, dyn_array<uint_t<160>>>;
   using values = std::tuple<abi::cpp_t<dyn_array<int_t<56>>>, abi::cpp_t<dyn_array<uint_t<160>>>>;
+  static constexpr std::array<const char*, 2> field_names{{"tickCumulatives", "secondsPerLiquidityCumulativeX128s"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_Observe& s) {
@@ -621,6 +811,14 @@ struct IUniswapV3Pool_Observe {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_Observe& s) {
+    return std::tie(s.tickCumulatives, s.secondsPerLiquidityCumulativeX128s);
+  }
+  static auto tie(IUniswapV3Pool_Observe& s) {
+    return std::tie(s.tickCumulatives, s.secondsPerLiquidityCumulativeX128s);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_Observe from_tuple(const values& t) {
     IUniswapV3Pool_Observe s{};
@@ -641,6 +839,7 @@ struct IUniswapV3Pool_Positions {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<128>, uint_t<256>, uint_t<256>, uint_t<128>, uint_t<128>>;
   using values = std::tuple<abi::cpp_t<uint_t<128>>, abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<128>>, abi::cpp_t<uint_t<128>>>;
+  static constexpr std::array<const char*, 5> field_names{{"liquidity", "feeGrowthInside0LastX128", "feeGrowthInside1LastX128", "tokensOwed0", "tokensOwed1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_Positions& s) {
@@ -653,6 +852,14 @@ struct IUniswapV3Pool_Positions {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_Positions& s) {
+    return std::tie(s.liquidity, s.feeGrowthInside0LastX128, s.feeGrowthInside1LastX128, s.tokensOwed0, s.tokensOwed1);
+  }
+  static auto tie(IUniswapV3Pool_Positions& s) {
+    return std::tie(s.liquidity, s.feeGrowthInside0LastX128, s.feeGrowthInside1LastX128, s.tokensOwed0, s.tokensOwed1);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_Positions from_tuple(const values& t) {
     IUniswapV3Pool_Positions s{};
@@ -673,6 +880,7 @@ struct IUniswapV3Pool_ProtocolFees {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<128>, uint_t<128>>;
   using values = std::tuple<abi::cpp_t<uint_t<128>>, abi::cpp_t<uint_t<128>>>;
+  static constexpr std::array<const char*, 2> field_names{{"token0", "token1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_ProtocolFees& s) {
@@ -682,6 +890,14 @@ struct IUniswapV3Pool_ProtocolFees {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_ProtocolFees& s) {
+    return std::tie(s.token0, s.token1);
+  }
+  static auto tie(IUniswapV3Pool_ProtocolFees& s) {
+    return std::tie(s.token0, s.token1);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_ProtocolFees from_tuple(const values& t) {
     IUniswapV3Pool_ProtocolFees s{};
@@ -704,6 +920,7 @@ struct IUniswapV3Pool_Slot0 {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<160>, int_t<24>, uint_t<16>, uint_t<16>, uint_t<16>, uint_t<8>, bool_t>;
   using values = std::tuple<abi::cpp_t<uint_t<160>>, abi::cpp_t<int_t<24>>, abi::cpp_t<uint_t<16>>, abi::cpp_t<uint_t<16>>, abi::cpp_t<uint_t<16>>, abi::cpp_t<uint_t<8>>, abi::cpp_t<bool_t>>;
+  static constexpr std::array<const char*, 7> field_names{{"sqrtPriceX96", "tick", "observationIndex", "observationCardinality", "observationCardinalityNext", "feeProtocol", "unlocked"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_Slot0& s) {
@@ -718,6 +935,14 @@ struct IUniswapV3Pool_Slot0 {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_Slot0& s) {
+    return std::tie(s.sqrtPriceX96, s.tick, s.observationIndex, s.observationCardinality, s.observationCardinalityNext, s.feeProtocol, s.unlocked);
+  }
+  static auto tie(IUniswapV3Pool_Slot0& s) {
+    return std::tie(s.sqrtPriceX96, s.tick, s.observationIndex, s.observationCardinality, s.observationCardinalityNext, s.feeProtocol, s.unlocked);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_Slot0 from_tuple(const values& t) {
     IUniswapV3Pool_Slot0 s{};
@@ -741,6 +966,7 @@ struct IUniswapV3Pool_SnapshotCumulativesInside {
   // Underlying ABI schema
   using schema = abi::tuple<int_t<56>, uint_t<160>, uint_t<32>>;
   using values = std::tuple<abi::cpp_t<int_t<56>>, abi::cpp_t<uint_t<160>>, abi::cpp_t<uint_t<32>>>;
+  static constexpr std::array<const char*, 3> field_names{{"tickCumulativeInside", "secondsPerLiquidityInsideX128", "secondsInside"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_SnapshotCumulativesInside& s) {
@@ -751,6 +977,14 @@ struct IUniswapV3Pool_SnapshotCumulativesInside {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_SnapshotCumulativesInside& s) {
+    return std::tie(s.tickCumulativeInside, s.secondsPerLiquidityInsideX128, s.secondsInside);
+  }
+  static auto tie(IUniswapV3Pool_SnapshotCumulativesInside& s) {
+    return std::tie(s.tickCumulativeInside, s.secondsPerLiquidityInsideX128, s.secondsInside);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_SnapshotCumulativesInside from_tuple(const values& t) {
     IUniswapV3Pool_SnapshotCumulativesInside s{};
@@ -769,6 +1003,7 @@ struct IUniswapV3Pool_Swap {
   // Underlying ABI schema
   using schema = abi::tuple<int_t<256>, int_t<256>>;
   using values = std::tuple<abi::cpp_t<int_t<256>>, abi::cpp_t<int_t<256>>>;
+  static constexpr std::array<const char*, 2> field_names{{"amount0", "amount1"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_Swap& s) {
@@ -778,6 +1013,14 @@ struct IUniswapV3Pool_Swap {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_Swap& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+  static auto tie(IUniswapV3Pool_Swap& s) {
+    return std::tie(s.amount0, s.amount1);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_Swap from_tuple(const values& t) {
     IUniswapV3Pool_Swap s{};
@@ -801,6 +1044,7 @@ struct IUniswapV3Pool_Ticks {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<128>, int_t<128>, uint_t<256>, uint_t<256>, int_t<56>, uint_t<160>, uint_t<32>, bool_t>;
   using values = std::tuple<abi::cpp_t<uint_t<128>>, abi::cpp_t<int_t<128>>, abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>, abi::cpp_t<int_t<56>>, abi::cpp_t<uint_t<160>>, abi::cpp_t<uint_t<32>>, abi::cpp_t<bool_t>>;
+  static constexpr std::array<const char*, 8> field_names{{"liquidityGross", "liquidityNet", "feeGrowthOutside0X128", "feeGrowthOutside1X128", "tickCumulativeOutside", "secondsPerLiquidityOutsideX128", "secondsOutside", "initialized"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV3Pool_Ticks& s) {
@@ -816,6 +1060,14 @@ struct IUniswapV3Pool_Ticks {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_Ticks& s) {
+    return std::tie(s.liquidityGross, s.liquidityNet, s.feeGrowthOutside0X128, s.feeGrowthOutside1X128, s.tickCumulativeOutside, s.secondsPerLiquidityOutsideX128, s.secondsOutside, s.initialized);
+  }
+  static auto tie(IUniswapV3Pool_Ticks& s) {
+    return std::tie(s.liquidityGross, s.liquidityNet, s.feeGrowthOutside0X128, s.feeGrowthOutside1X128, s.tickCumulativeOutside, s.secondsPerLiquidityOutsideX128, s.secondsOutside, s.initialized);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV3Pool_Ticks from_tuple(const values& t) {
     IUniswapV3Pool_Ticks s{};
@@ -839,6 +1091,7 @@ struct IMulticall_Aggregate {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<256>, dyn_array<bytes>>;
   using values = std::tuple<abi::cpp_t<uint_t<256>>, abi::cpp_t<dyn_array<bytes>>>;
+  static constexpr std::array<const char*, 2> field_names{{"blockNumber", "returnData"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IMulticall_Aggregate& s) {
@@ -848,6 +1101,14 @@ struct IMulticall_Aggregate {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IMulticall_Aggregate& s) {
+    return std::tie(s.blockNumber, s.returnData);
+  }
+  static auto tie(IMulticall_Aggregate& s) {
+    return std::tie(s.blockNumber, s.returnData);
+  }
+
   // Conversion from underlying tuple values
   static IMulticall_Aggregate from_tuple(const values& t) {
     IMulticall_Aggregate s{};
@@ -866,6 +1127,7 @@ struct IMulticall_BlockAndAggregate {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<256>, uint_t<256>, dyn_array<Multicall3_Result>>;
   using values = std::tuple<abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>, std::vector<Multicall3_Result>>;
+  static constexpr std::array<const char*, 3> field_names{{"blockNumber", "blockHash", "returnData"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IMulticall_BlockAndAggregate& s) {
@@ -876,6 +1138,14 @@ struct IMulticall_BlockAndAggregate {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IMulticall_BlockAndAggregate& s) {
+    return std::tie(s.blockNumber, s.blockHash, s.returnData);
+  }
+  static auto tie(IMulticall_BlockAndAggregate& s) {
+    return std::tie(s.blockNumber, s.blockHash, s.returnData);
+  }
+
   // Conversion from underlying tuple values
   static IMulticall_BlockAndAggregate from_tuple(const values& t) {
     IMulticall_BlockAndAggregate s{};
@@ -895,6 +1165,7 @@ struct IMulticall_TryBlockAndAggregate {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<256>, uint_t<256>, dyn_array<Multicall3_Result>>;
   using values = std::tuple<abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>, std::vector<Multicall3_Result>>;
+  static constexpr std::array<const char*, 3> field_names{{"blockNumber", "blockHash", "returnData"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IMulticall_TryBlockAndAggregate& s) {
@@ -905,6 +1176,14 @@ struct IMulticall_TryBlockAndAggregate {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IMulticall_TryBlockAndAggregate& s) {
+    return std::tie(s.blockNumber, s.blockHash, s.returnData);
+  }
+  static auto tie(IMulticall_TryBlockAndAggregate& s) {
+    return std::tie(s.blockNumber, s.blockHash, s.returnData);
+  }
+
   // Conversion from underlying tuple values
   static IMulticall_TryBlockAndAggregate from_tuple(const values& t) {
     IMulticall_TryBlockAndAggregate s{};
@@ -924,6 +1203,7 @@ struct IUniswapV2Router_AddLiquidity {
   // Underlying ABI schema
   using schema = abi::tuple<uint_t<256>, uint_t<256>, uint_t<256>>;
   using values = std::tuple<abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>, abi::cpp_t<uint_t<256>>>;
+  static constexpr std::array<const char*, 3> field_names{{"amountA", "amountB", "liquidity"}};
 
   // Conversion to underlying tuple values
   static values to_tuple(const IUniswapV2Router_AddLiquidity& s) {
@@ -934,6 +1214,14 @@ struct IUniswapV2Router_AddLiquidity {
     );
   }
 
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV2Router_AddLiquidity& s) {
+    return std::tie(s.amountA, s.amountB, s.liquidity);
+  }
+  static auto tie(IUniswapV2Router_AddLiquidity& s) {
+    return std::tie(s.amountA, s.amountB, s.liquidity);
+  }
+
   // Conversion from underlying tuple values
   static IUniswapV2Router_AddLiquidity from_tuple(const values& t) {
     IUniswapV2Router_AddLiquidity s{};
@@ -952,39 +1240,384 @@ struct IUniswapV2Router_AddLiquidity {
 // Traits specializations for named structs (in abi namespace)
 // ==============================
 
-// value_of specializations for named structs
-template<> struct value_of<protocols::ITickLens_PopulatedTick> { using type = protocols::ITickLens_PopulatedTick; };
-template<> struct value_of<protocols::Multicall3_Call> { using type = protocols::Multicall3_Call; };
-template<> struct value_of<protocols::Multicall3_Call3> { using type = protocols::Multicall3_Call3; };
-template<> struct value_of<protocols::Multicall3_Result> { using type = protocols::Multicall3_Result; };
-template<> struct value_of<protocols::Multicall3_Call3Value> { using type = protocols::Multicall3_Call3Value; };
-template<> struct value_of<protocols::ERC20_TransferEventData> { using type = protocols::ERC20_TransferEventData; };
-template<> struct value_of<protocols::ERC20_ApprovalEventData> { using type = protocols::ERC20_ApprovalEventData; };
-template<> struct value_of<protocols::UniswapV3Pool_BurnEventData> { using type = protocols::UniswapV3Pool_BurnEventData; };
-template<> struct value_of<protocols::UniswapV3Pool_CollectEventData> { using type = protocols::UniswapV3Pool_CollectEventData; };
-template<> struct value_of<protocols::UniswapV3Pool_CollectProtocolEventData> { using type = protocols::UniswapV3Pool_CollectProtocolEventData; };
-template<> struct value_of<protocols::UniswapV3Pool_FlashEventData> { using type = protocols::UniswapV3Pool_FlashEventData; };
-template<> struct value_of<protocols::UniswapV3Pool_IncreaseObservationCardinalityNextEventData> { using type = protocols::UniswapV3Pool_IncreaseObservationCardinalityNextEventData; };
-template<> struct value_of<protocols::UniswapV3Pool_InitializeEventData> { using type = protocols::UniswapV3Pool_InitializeEventData; };
-template<> struct value_of<protocols::UniswapV3Pool_MintEventData> { using type = protocols::UniswapV3Pool_MintEventData; };
-template<> struct value_of<protocols::UniswapV3Pool_SetFeeProtocolEventData> { using type = protocols::UniswapV3Pool_SetFeeProtocolEventData; };
-template<> struct value_of<protocols::UniswapV3Pool_SwapEventData> { using type = protocols::UniswapV3Pool_SwapEventData; };
-template<> struct value_of<protocols::IUniswapV3Pool_Burn> { using type = protocols::IUniswapV3Pool_Burn; };
-template<> struct value_of<protocols::IUniswapV3Pool_Collect> { using type = protocols::IUniswapV3Pool_Collect; };
-template<> struct value_of<protocols::IUniswapV3Pool_CollectProtocol> { using type = protocols::IUniswapV3Pool_CollectProtocol; };
-template<> struct value_of<protocols::IUniswapV3Pool_Mint> { using type = protocols::IUniswapV3Pool_Mint; };
-template<> struct value_of<protocols::IUniswapV3Pool_Observations> { using type = protocols::IUniswapV3Pool_Observations; };
-template<> struct value_of<protocols::IUniswapV3Pool_Observe> { using type = protocols::IUniswapV3Pool_Observe; };
-template<> struct value_of<protocols::IUniswapV3Pool_Positions> { using type = protocols::IUniswapV3Pool_Positions; };
-template<> struct value_of<protocols::IUniswapV3Pool_ProtocolFees> { using type = protocols::IUniswapV3Pool_ProtocolFees; };
-template<> struct value_of<protocols::IUniswapV3Pool_Slot0> { using type = protocols::IUniswapV3Pool_Slot0; };
-template<> struct value_of<protocols::IUniswapV3Pool_SnapshotCumulativesInside> { using type = protocols::IUniswapV3Pool_SnapshotCumulativesInside; };
-template<> struct value_of<protocols::IUniswapV3Pool_Swap> { using type = protocols::IUniswapV3Pool_Swap; };
-template<> struct value_of<protocols::IUniswapV3Pool_Ticks> { using type = protocols::IUniswapV3Pool_Ticks; };
-template<> struct value_of<protocols::IMulticall_Aggregate> { using type = protocols::IMulticall_Aggregate; };
-template<> struct value_of<protocols::IMulticall_BlockAndAggregate> { using type = protocols::IMulticall_BlockAndAggregate; };
-template<> struct value_of<protocols::IMulticall_TryBlockAndAggregate> { using type = protocols::IMulticall_TryBlockAndAggregate; };
-template<> struct value_of<protocols::IUniswapV2Router_AddLiquidity> { using type = protocols::IUniswapV2Router_AddLiquidity; };
+// value_of specializations for named structs (the struct itself, whatever the containers)
+template<class C> struct value_of<protocols::ITickLens_PopulatedTick, C> { using type = protocols::ITickLens_PopulatedTick; };
+template<class C> struct value_of<protocols::Multicall3_Call, C> { using type = protocols::Multicall3_Call; };
+template<class C> struct value_of<protocols::Multicall3_Call3, C> { using type = protocols::Multicall3_Call3; };
+template<class C> struct value_of<protocols::Multicall3_Result, C> { using type = protocols::Multicall3_Result; };
+template<class C> struct value_of<protocols::Multicall3_Call3Value, C> { using type = protocols::Multicall3_Call3Value; };
+template<class C> struct value_of<protocols::ERC20_TransferEventData, C> { using type = protocols::ERC20_TransferEventData; };
+template<class C> struct value_of<protocols::ERC20_ApprovalEventData, C> { using type = protocols::ERC20_ApprovalEventData; };
+template<class C> struct value_of<protocols::UniswapV3Pool_BurnEventData, C> { using type = protocols::UniswapV3Pool_BurnEventData; };
+template<class C> struct value_of<protocols::UniswapV3Pool_CollectEventData, C> { using type = protocols::UniswapV3Pool_CollectEventData; };
+template<class C> struct value_of<protocols::UniswapV3Pool_CollectProtocolEventData, C> { using type = protocols::UniswapV3Pool_CollectProtocolEventData; };
+template<class C> struct value_of<protocols::UniswapV3Pool_FlashEventData, C> { using type = protocols::UniswapV3Pool_FlashEventData; };
+template<class C> struct value_of<protocols::UniswapV3Pool_IncreaseObservationCardinalityNextEventData, C> { using type = protocols::UniswapV3Pool_IncreaseObservationCardinalityNextEventData; };
+template<class C> struct value_of<protocols::UniswapV3Pool_InitializeEventData, C> { using type = protocols::UniswapV3Pool_InitializeEventData; };
+template<class C> struct value_of<protocols::UniswapV3Pool_MintEventData, C> { using type = protocols::UniswapV3Pool_MintEventData; };
+template<class C> struct value_of<protocols::UniswapV3Pool_SetFeeProtocolEventData, C> { using type = protocols::UniswapV3Pool_SetFeeProtocolEventData; };
+template<class C> struct value_of<protocols::UniswapV3Pool_SwapEventData, C> { using type = protocols::UniswapV3Pool_SwapEventData; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_Burn, C> { using type = protocols::IUniswapV3Pool_Burn; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_Collect, C> { using type = protocols::IUniswapV3Pool_Collect; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_CollectProtocol, C> { using type = protocols::IUniswapV3Pool_CollectProtocol; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_Mint, C> { using type = protocols::IUniswapV3Pool_Mint; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_Observations, C> { using type = protocols::IUniswapV3Pool_Observations; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_Observe, C> { using type = protocols::IUniswapV3Pool_Observe; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_Positions, C> { using type = protocols::IUniswapV3Pool_Positions; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_ProtocolFees, C> { using type = protocols::IUniswapV3Pool_ProtocolFees; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_Slot0, C> { using type = protocols::IUniswapV3Pool_Slot0; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_SnapshotCumulativesInside, C> { using type = protocols::IUniswapV3Pool_SnapshotCumulativesInside; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_Swap, C> { using type = protocols::IUniswapV3Pool_Swap; };
+template<class C> struct value_of<protocols::IUniswapV3Pool_Ticks, C> { using type = protocols::IUniswapV3Pool_Ticks; };
+template<class C> struct value_of<protocols::IMulticall_Aggregate, C> { using type = protocols::IMulticall_Aggregate; };
+template<class C> struct value_of<protocols::IMulticall_BlockAndAggregate, C> { using type = protocols::IMulticall_BlockAndAggregate; };
+template<class C> struct value_of<protocols::IMulticall_TryBlockAndAggregate, C> { using type = protocols::IMulticall_TryBlockAndAggregate; };
+template<class C> struct value_of<protocols::IUniswapV2Router_AddLiquidity, C> { using type = protocols::IUniswapV2Router_AddLiquidity; };
+
+namespace protocols {
+namespace pmr {
+struct Multicall3_Call;
+struct Multicall3_Call3;
+struct Multicall3_Result;
+struct Multicall3_Call3Value;
+struct IUniswapV3Pool_Observe;
+struct IMulticall_Aggregate;
+struct IMulticall_BlockAndAggregate;
+struct IMulticall_TryBlockAndAggregate;
+} // namespace pmr
+} // namespace protocols
+
+// value_of specializations for pmr_containers (the allocator-aware twin)
+template<> struct value_of<protocols::Multicall3_Call, pmr_containers> { using type = protocols::pmr::Multicall3_Call; };
+template<> struct value_of<protocols::Multicall3_Call3, pmr_containers> { using type = protocols::pmr::Multicall3_Call3; };
+template<> struct value_of<protocols::Multicall3_Result, pmr_containers> { using type = protocols::pmr::Multicall3_Result; };
+template<> struct value_of<protocols::Multicall3_Call3Value, pmr_containers> { using type = protocols::pmr::Multicall3_Call3Value; };
+template<> struct value_of<protocols::IUniswapV3Pool_Observe, pmr_containers> { using type = protocols::pmr::IUniswapV3Pool_Observe; };
+template<> struct value_of<protocols::IMulticall_Aggregate, pmr_containers> { using type = protocols::pmr::IMulticall_Aggregate; };
+template<> struct value_of<protocols::IMulticall_BlockAndAggregate, pmr_containers> { using type = protocols::pmr::IMulticall_BlockAndAggregate; };
+template<> struct value_of<protocols::IMulticall_TryBlockAndAggregate, pmr_containers> { using type = protocols::pmr::IMulticall_TryBlockAndAggregate; };
+
+namespace protocols {
+namespace pmr {
+
+// ---------- Allocator-aware Multicall3.Call ----------
+struct Multicall3_Call {
+  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  abi::pmr_value_t<address20> target{};
+  abi::pmr_value_t<bytes> callData{};
+
+  // Underlying ABI schema
+  using schema = abi::tuple<address20, bytes>;
+  static constexpr std::array<const char*, 2> field_names{{"target", "callData"}};
+
+  // Members that allocate use a, including when copied or moved into a
+  // std::pmr container
+  Multicall3_Call() = default;
+  explicit Multicall3_Call(const allocator_type& a)
+    : target(abi::detail::make_with_allocator<decltype(target)>(a)),
+      callData(abi::detail::make_with_allocator<decltype(callData)>(a)) {}
+  Multicall3_Call(const Multicall3_Call& o, const allocator_type& a)
+    : target(abi::detail::make_with_allocator<decltype(target)>(a, o.target)),
+      callData(abi::detail::make_with_allocator<decltype(callData)>(a, o.callData)) {}
+  Multicall3_Call(Multicall3_Call&& o, const allocator_type& a)
+    : target(abi::detail::make_with_allocator<decltype(target)>(a, std::move(o.target))),
+      callData(abi::detail::make_with_allocator<decltype(callData)>(a, std::move(o.callData))) {}
+  Multicall3_Call(const Multicall3_Call&) = default;
+  Multicall3_Call(Multicall3_Call&&) = default;
+  Multicall3_Call& operator=(const Multicall3_Call&) = default;
+  Multicall3_Call& operator=(Multicall3_Call&&) = default;
+
+  // Borrowed references to the fields, in schema order
+  static auto tie(const Multicall3_Call& s) {
+    return std::tie(s.target, s.callData);
+  }
+  static auto tie(Multicall3_Call& s) {
+    return std::tie(s.target, s.callData);
+  }
+};
+
+// ---------- Allocator-aware Multicall3.Call3 ----------
+struct Multicall3_Call3 {
+  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  abi::pmr_value_t<address20> target{};
+  abi::pmr_value_t<bool_t> allowFailure{};
+  abi::pmr_value_t<bytes> callData{};
+
+  // Underlying ABI schema
+  using schema = abi::tuple<address20, bool_t, bytes>;
+  static constexpr std::array<const char*, 3> field_names{{"target", "allowFailure", "callData"}};
+
+  // Members that allocate use a, including when copied or moved into a
+  // std::pmr container
+  Multicall3_Call3() = default;
+  explicit Multicall3_Call3(const allocator_type& a)
+    : target(abi::detail::make_with_allocator<decltype(target)>(a)),
+      allowFailure(abi::detail::make_with_allocator<decltype(allowFailure)>(a)),
+      callData(abi::detail::make_with_allocator<decltype(callData)>(a)) {}
+  Multicall3_Call3(const Multicall3_Call3& o, const allocator_type& a)
+    : target(abi::detail::make_with_allocator<decltype(target)>(a, o.target)),
+      allowFailure(abi::detail::make_with_allocator<decltype(allowFailure)>(a, o.allowFailure)),
+      callData(abi::detail::make_with_allocator<decltype(callData)>(a, o.callData)) {}
+  Multicall3_Call3(Multicall3_Call3&& o, const allocator_type& a)
+    : target(abi::detail::make_with_allocator<decltype(target)>(a, std::move(o.target))),
+      allowFailure(abi::detail::make_with_allocator<decltype(allowFailure)>(a, std::move(o.allowFailure))),
+      callData(abi::detail::make_with_allocator<decltype(callData)>(a, std::move(o.callData))) {}
+  Multicall3_Call3(const Multicall3_Call3&) = default;
+  Multicall3_Call3(Multicall3_Call3&&) = default;
+  Multicall3_Call3& operator=(const Multicall3_Call3&) = default;
+  Multicall3_Call3& operator=(Multicall3_Call3&&) = default;
+
+  // Borrowed references to the fields, in schema order
+  static auto tie(const Multicall3_Call3& s) {
+    return std::tie(s.target, s.allowFailure, s.callData);
+  }
+  static auto tie(Multicall3_Call3& s) {
+    return std::tie(s.target, s.allowFailure, s.callData);
+  }
+};
+
+// ---------- Allocator-aware Multicall3.Result ----------
+struct Multicall3_Result {
+  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  abi::pmr_value_t<bool_t> success{};
+  abi::pmr_value_t<bytes> returnData{};
+
+  // Underlying ABI schema
+  using schema = abi::tuple<bool_t, bytes>;
+  static constexpr std::array<const char*, 2> field_names{{"success", "returnData"}};
+
+  // Members that allocate use a, including when copied or moved into a
+  // std::pmr container
+  Multicall3_Result() = default;
+  explicit Multicall3_Result(const allocator_type& a)
+    : success(abi::detail::make_with_allocator<decltype(success)>(a)),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a)) {}
+  Multicall3_Result(const Multicall3_Result& o, const allocator_type& a)
+    : success(abi::detail::make_with_allocator<decltype(success)>(a, o.success)),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a, o.returnData)) {}
+  Multicall3_Result(Multicall3_Result&& o, const allocator_type& a)
+    : success(abi::detail::make_with_allocator<decltype(success)>(a, std::move(o.success))),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a, std::move(o.returnData))) {}
+  Multicall3_Result(const Multicall3_Result&) = default;
+  Multicall3_Result(Multicall3_Result&&) = default;
+  Multicall3_Result& operator=(const Multicall3_Result&) = default;
+  Multicall3_Result& operator=(Multicall3_Result&&) = default;
+
+  // Borrowed references to the fields, in schema order
+  static auto tie(const Multicall3_Result& s) {
+    return std::tie(s.success, s.returnData);
+  }
+  static auto tie(Multicall3_Result& s) {
+    return std::tie(s.success, s.returnData);
+  }
+};
+
+// ---------- Allocator-aware Multicall3.Call3Value ----------
+struct Multicall3_Call3Value {
+  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  abi::pmr_value_t<address20> target{};
+  abi::pmr_value_t<bool_t> allowFailure{};
+  abi::pmr_value_t<uint_t<256>> value{};
+  abi::pmr_value_t<bytes> callData{};
+
+  // Underlying ABI schema
+  using schema = abi::tuple<address20, bool_t, uint_t<256>, bytes>;
+  static constexpr std::array<const char*, 4> field_names{{"target", "allowFailure", "value", "callData"}};
+
+  // Members that allocate use a, including when copied or moved into a
+  // std::pmr container
+  Multicall3_Call3Value() = default;
+  explicit Multicall3_Call3Value(const allocator_type& a)
+    : target(abi::detail::make_with_allocator<decltype(target)>(a)),
+      allowFailure(abi::detail::make_with_allocator<decltype(allowFailure)>(a)),
+      value(abi::detail::make_with_allocator<decltype(value)>(a)),
+      callData(abi::detail::make_with_allocator<decltype(callData)>(a)) {}
+  Multicall3_Call3Value(const Multicall3_Call3Value& o, const allocator_type& a)
+    : target(abi::detail::make_with_allocator<decltype(target)>(a, o.target)),
+      allowFailure(abi::detail::make_with_allocator<decltype(allowFailure)>(a, o.allowFailure)),
+      value(abi::detail::make_with_allocator<decltype(value)>(a, o.value)),
+      callData(abi::detail::make_with_allocator<decltype(callData)>(a, o.callData)) {}
+  Multicall3_Call3Value(Multicall3_Call3Value&& o, const allocator_type& a)
+    : target(abi::detail::make_with_allocator<decltype(target)>(a, std::move(o.target))),
+      allowFailure(abi::detail::make_with_allocator<decltype(allowFailure)>(a, std::move(o.allowFailure))),
+      value(abi::detail::make_with_allocator<decltype(value)>(a, std::move(o.value))),
+      callData(abi::detail::make_with_allocator<decltype(callData)>(a, std::move(o.callData))) {}
+  Multicall3_Call3Value(const Multicall3_Call3Value&) = default;
+  Multicall3_Call3Value(Multicall3_Call3Value&&) = default;
+  Multicall3_Call3Value& operator=(const Multicall3_Call3Value&) = default;
+  Multicall3_Call3Value& operator=(Multicall3_Call3Value&&) = default;
+
+  // Borrowed references to the fields, in schema order
+  static auto tie(const Multicall3_Call3Value& s) {
+    return std::tie(s.target, s.allowFailure, s.value, s.callData);
+  }
+  static auto tie(Multicall3_Call3Value& s) {
+    return std::tie(s.target, s.allowFailure, s.value, s.callData);
+  }
+};
+
+// ---------- Allocator-aware IUniswapV3Pool.Observe ----------
+struct IUniswapV3Pool_Observe {
+  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  abi::pmr_value_t<dyn_array<int_t<56>>> tickCumulatives{};
+  abi::pmr_value_t<dyn_array<uint_t<160>>> secondsPerLiquidityCumulativeX128s{};
+
+  // Underlying ABI schema
+  using schema = abi::tuple<dyn_array<int_t<56>>, dyn_array<uint_t<160>>>;
+  static constexpr std::array<const char*, 2> field_names{{"tickCumulatives", "secondsPerLiquidityCumulativeX128s"}};
+
+  // Members that allocate use a, including when copied or moved into a
+  // std::pmr container
+  IUniswapV3Pool_Observe() = default;
+  explicit IUniswapV3Pool_Observe(const allocator_type& a)
+    : tickCumulatives(abi::detail::make_with_allocator<decltype(tickCumulatives)>(a)),
+      secondsPerLiquidityCumulativeX128s(abi::detail::make_with_allocator<decltype(secondsPerLiquidityCumulativeX128s)>(a)) {}
+  IUniswapV3Pool_Observe(const IUniswapV3Pool_Observe& o, const allocator_type& a)
+    : tickCumulatives(abi::detail::make_with_allocator<decltype(tickCumulatives)>(a, o.tickCumulatives)),
+      secondsPerLiquidityCumulativeX128s(abi::detail::make_with_allocator<decltype(secondsPerLiquidityCumulativeX128s)>(a, o.secondsPerLiquidityCumulativeX128s)) {}
+  IUniswapV3Pool_Observe(IUniswapV3Pool_Observe&& o, const allocator_type& a)
+    : tickCumulatives(abi::detail::make_with_allocator<decltype(tickCumulatives)>(a, std::move(o.tickCumulatives))),
+      secondsPerLiquidityCumulativeX128s(abi::detail::make_with_allocator<decltype(secondsPerLiquidityCumulativeX128s)>(a, std::move(o.secondsPerLiquidityCumulativeX128s))) {}
+  IUniswapV3Pool_Observe(const IUniswapV3Pool_Observe&) = default;
+  IUniswapV3Pool_Observe(IUniswapV3Pool_Observe&&) = default;
+  IUniswapV3Pool_Observe& operator=(const IUniswapV3Pool_Observe&) = default;
+  IUniswapV3Pool_Observe& operator=(IUniswapV3Pool_Observe&&) = default;
+
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IUniswapV3Pool_Observe& s) {
+    return std::tie(s.tickCumulatives, s.secondsPerLiquidityCumulativeX128s);
+  }
+  static auto tie(IUniswapV3Pool_Observe& s) {
+    return std::tie(s.tickCumulatives, s.secondsPerLiquidityCumulativeX128s);
+  }
+};
+
+// ---------- Allocator-aware IMulticall.Aggregate ----------
+struct IMulticall_Aggregate {
+  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  abi::pmr_value_t<uint_t<256>> blockNumber{};
+  abi::pmr_value_t<dyn_array<bytes>> returnData{};
+
+  // Underlying ABI schema
+  using schema = abi::tuple<uint_t<256>, dyn_array<bytes>>;
+  static constexpr std::array<const char*, 2> field_names{{"blockNumber", "returnData"}};
+
+  // Members that allocate use a, including when copied or moved into a
+  // std::pmr container
+  IMulticall_Aggregate() = default;
+  explicit IMulticall_Aggregate(const allocator_type& a)
+    : blockNumber(abi::detail::make_with_allocator<decltype(blockNumber)>(a)),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a)) {}
+  IMulticall_Aggregate(const IMulticall_Aggregate& o, const allocator_type& a)
+    : blockNumber(abi::detail::make_with_allocator<decltype(blockNumber)>(a, o.blockNumber)),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a, o.returnData)) {}
+  IMulticall_Aggregate(IMulticall_Aggregate&& o, const allocator_type& a)
+    : blockNumber(abi::detail::make_with_allocator<decltype(blockNumber)>(a, std::move(o.blockNumber))),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a, std::move(o.returnData))) {}
+  IMulticall_Aggregate(const IMulticall_Aggregate&) = default;
+  IMulticall_Aggregate(IMulticall_Aggregate&&) = default;
+  IMulticall_Aggregate& operator=(const IMulticall_Aggregate&) = default;
+  IMulticall_Aggregate& operator=(IMulticall_Aggregate&&) = default;
+
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IMulticall_Aggregate& s) {
+    return std::tie(s.blockNumber, s.returnData);
+  }
+  static auto tie(IMulticall_Aggregate& s) {
+    return std::tie(s.blockNumber, s.returnData);
+  }
+};
+
+// ---------- Allocator-aware IMulticall.BlockAndAggregate ----------
+struct IMulticall_BlockAndAggregate {
+  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  abi::pmr_value_t<uint_t<256>> blockNumber{};
+  abi::pmr_value_t<uint_t<256>> blockHash{};
+  abi::pmr_value_t<dyn_array<protocols::Multicall3_Result>> returnData{};
+
+  // Underlying ABI schema
+  using schema = abi::tuple<uint_t<256>, uint_t<256>, dyn_array<protocols::Multicall3_Result>>;
+  static constexpr std::array<const char*, 3> field_names{{"blockNumber", "blockHash", "returnData"}};
+
+  // Members that allocate use a, including when copied or moved into a
+  // std::pmr container
+  IMulticall_BlockAndAggregate() = default;
+  explicit IMulticall_BlockAndAggregate(const allocator_type& a)
+    : blockNumber(abi::detail::make_with_allocator<decltype(blockNumber)>(a)),
+      blockHash(abi::detail::make_with_allocator<decltype(blockHash)>(a)),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a)) {}
+  IMulticall_BlockAndAggregate(const IMulticall_BlockAndAggregate& o, const allocator_type& a)
+    : blockNumber(abi::detail::make_with_allocator<decltype(blockNumber)>(a, o.blockNumber)),
+      blockHash(abi::detail::make_with_allocator<decltype(blockHash)>(a, o.blockHash)),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a, o.returnData)) {}
+  IMulticall_BlockAndAggregate(IMulticall_BlockAndAggregate&& o, const allocator_type& a)
+    : blockNumber(abi::detail::make_with_allocator<decltype(blockNumber)>(a, std::move(o.blockNumber))),
+      blockHash(abi::detail::make_with_allocator<decltype(blockHash)>(a, std::move(o.blockHash))),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a, std::move(o.returnData))) {}
+  IMulticall_BlockAndAggregate(const IMulticall_BlockAndAggregate&) = default;
+  IMulticall_BlockAndAggregate(IMulticall_BlockAndAggregate&&) = default;
+  IMulticall_BlockAndAggregate& operator=(const IMulticall_BlockAndAggregate&) = default;
+  IMulticall_BlockAndAggregate& operator=(IMulticall_BlockAndAggregate&&) = default;
+
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IMulticall_BlockAndAggregate& s) {
+    return std::tie(s.blockNumber, s.blockHash, s.returnData);
+  }
+  static auto tie(IMulticall_BlockAndAggregate& s) {
+    return std::tie(s.blockNumber, s.blockHash, s.returnData);
+  }
+};
+
+// ---------- Allocator-aware IMulticall.TryBlockAndAggregate ----------
+struct IMulticall_TryBlockAndAggregate {
+  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+  abi::pmr_value_t<uint_t<256>> blockNumber{};
+  abi::pmr_value_t<uint_t<256>> blockHash{};
+  abi::pmr_value_t<dyn_array<protocols::Multicall3_Result>> returnData{};
+
+  // Underlying ABI schema
+  using schema = abi::tuple<uint_t<256>, uint_t<256>, dyn_array<protocols::Multicall3_Result>>;
+  static constexpr std::array<const char*, 3> field_names{{"blockNumber", "blockHash", "returnData"}};
+
+  // Members that allocate use a, including when copied or moved into a
+  // std::pmr container
+  IMulticall_TryBlockAndAggregate() = default;
+  explicit IMulticall_TryBlockAndAggregate(const allocator_type& a)
+    : blockNumber(abi::detail::make_with_allocator<decltype(blockNumber)>(a)),
+      blockHash(abi::detail::make_with_allocator<decltype(blockHash)>(a)),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a)) {}
+  IMulticall_TryBlockAndAggregate(const IMulticall_TryBlockAndAggregate& o, const allocator_type& a)
+    : blockNumber(abi::detail::make_with_allocator<decltype(blockNumber)>(a, o.blockNumber)),
+      blockHash(abi::detail::make_with_allocator<decltype(blockHash)>(a, o.blockHash)),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a, o.returnData)) {}
+  IMulticall_TryBlockAndAggregate(IMulticall_TryBlockAndAggregate&& o, const allocator_type& a)
+    : blockNumber(abi::detail::make_with_allocator<decltype(blockNumber)>(a, std::move(o.blockNumber))),
+      blockHash(abi::detail::make_with_allocator<decltype(blockHash)>(a, std::move(o.blockHash))),
+      returnData(abi::detail::make_with_allocator<decltype(returnData)>(a, std::move(o.returnData))) {}
+  IMulticall_TryBlockAndAggregate(const IMulticall_TryBlockAndAggregate&) = default;
+  IMulticall_TryBlockAndAggregate(IMulticall_TryBlockAndAggregate&&) = default;
+  IMulticall_TryBlockAndAggregate& operator=(const IMulticall_TryBlockAndAggregate&) = default;
+  IMulticall_TryBlockAndAggregate& operator=(IMulticall_TryBlockAndAggregate&&) = default;
+
+  // Borrowed references to the fields, in schema order
+  static auto tie(const IMulticall_TryBlockAndAggregate& s) {
+    return std::tie(s.blockNumber, s.blockHash, s.returnData);
+  }
+  static auto tie(IMulticall_TryBlockAndAggregate& s) {
+    return std::tie(s.blockNumber, s.blockHash, s.returnData);
+  }
+};
+
+} // namespace pmr
+} // namespace protocols
 
 // traits specializations that delegate to underlying tuple schema
 template<> struct traits<protocols::ITickLens_PopulatedTick> {
@@ -1004,11 +1637,23 @@ template<> struct traits<protocols::ITickLens_PopulatedTick> {
     traits<S>::encode_tail(out, base, protocols::ITickLens_PopulatedTick::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::ITickLens_PopulatedTick& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::ITickLens_PopulatedTick::from_tuple(tmp);
-    return true;
+    auto fields = protocols::ITickLens_PopulatedTick::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1029,11 +1674,39 @@ template<> struct traits<protocols::Multicall3_Call> {
     traits<S>::encode_tail(out, base, protocols::Multicall3_Call::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::Multicall3_Call& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::Multicall3_Call::from_tuple(tmp);
-    return true;
+    auto fields = protocols::Multicall3_Call::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
+  }
+
+  // The allocator-aware twin encodes and decodes through its fields
+  static size_t tail_size(const protocols::pmr::Multicall3_Call& v) {
+    return traits<S>::tail_size(protocols::pmr::Multicall3_Call::tie(v));
+  }
+  static void encode_head(uint8_t* out32, size_t hi, const protocols::pmr::Multicall3_Call& v, size_t base) {
+    traits<S>::encode_head(out32, hi, protocols::pmr::Multicall3_Call::tie(v), base);
+  }
+  static void encode_tail(uint8_t* out, size_t base, const protocols::pmr::Multicall3_Call& v) {
+    traits<S>::encode_tail(out, base, protocols::pmr::Multicall3_Call::tie(v));
+  }
+  template <class P = checked>
+  static bool decode(BytesSpan in, protocols::pmr::Multicall3_Call& out, Error* e=nullptr) {
+    auto fields = protocols::pmr::Multicall3_Call::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1054,11 +1727,39 @@ template<> struct traits<protocols::Multicall3_Call3> {
     traits<S>::encode_tail(out, base, protocols::Multicall3_Call3::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::Multicall3_Call3& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::Multicall3_Call3::from_tuple(tmp);
-    return true;
+    auto fields = protocols::Multicall3_Call3::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
+  }
+
+  // The allocator-aware twin encodes and decodes through its fields
+  static size_t tail_size(const protocols::pmr::Multicall3_Call3& v) {
+    return traits<S>::tail_size(protocols::pmr::Multicall3_Call3::tie(v));
+  }
+  static void encode_head(uint8_t* out32, size_t hi, const protocols::pmr::Multicall3_Call3& v, size_t base) {
+    traits<S>::encode_head(out32, hi, protocols::pmr::Multicall3_Call3::tie(v), base);
+  }
+  static void encode_tail(uint8_t* out, size_t base, const protocols::pmr::Multicall3_Call3& v) {
+    traits<S>::encode_tail(out, base, protocols::pmr::Multicall3_Call3::tie(v));
+  }
+  template <class P = checked>
+  static bool decode(BytesSpan in, protocols::pmr::Multicall3_Call3& out, Error* e=nullptr) {
+    auto fields = protocols::pmr::Multicall3_Call3::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1079,11 +1780,39 @@ template<> struct traits<protocols::Multicall3_Result> {
     traits<S>::encode_tail(out, base, protocols::Multicall3_Result::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::Multicall3_Result& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::Multicall3_Result::from_tuple(tmp);
-    return true;
+    auto fields = protocols::Multicall3_Result::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
+  }
+
+  // The allocator-aware twin encodes and decodes through its fields
+  static size_t tail_size(const protocols::pmr::Multicall3_Result& v) {
+    return traits<S>::tail_size(protocols::pmr::Multicall3_Result::tie(v));
+  }
+  static void encode_head(uint8_t* out32, size_t hi, const protocols::pmr::Multicall3_Result& v, size_t base) {
+    traits<S>::encode_head(out32, hi, protocols::pmr::Multicall3_Result::tie(v), base);
+  }
+  static void encode_tail(uint8_t* out, size_t base, const protocols::pmr::Multicall3_Result& v) {
+    traits<S>::encode_tail(out, base, protocols::pmr::Multicall3_Result::tie(v));
+  }
+  template <class P = checked>
+  static bool decode(BytesSpan in, protocols::pmr::Multicall3_Result& out, Error* e=nullptr) {
+    auto fields = protocols::pmr::Multicall3_Result::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1104,11 +1833,39 @@ template<> struct traits<protocols::Multicall3_Call3Value> {
     traits<S>::encode_tail(out, base, protocols::Multicall3_Call3Value::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::Multicall3_Call3Value& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::Multicall3_Call3Value::from_tuple(tmp);
-    return true;
+    auto fields = protocols::Multicall3_Call3Value::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
+  }
+
+  // The allocator-aware twin encodes and decodes through its fields
+  static size_t tail_size(const protocols::pmr::Multicall3_Call3Value& v) {
+    return traits<S>::tail_size(protocols::pmr::Multicall3_Call3Value::tie(v));
+  }
+  static void encode_head(uint8_t* out32, size_t hi, const protocols::pmr::Multicall3_Call3Value& v, size_t base) {
+    traits<S>::encode_head(out32, hi, protocols::pmr::Multicall3_Call3Value::tie(v), base);
+  }
+  static void encode_tail(uint8_t* out, size_t base, const protocols::pmr::Multicall3_Call3Value& v) {
+    traits<S>::encode_tail(out, base, protocols::pmr::Multicall3_Call3Value::tie(v));
+  }
+  template <class P = checked>
+  static bool decode(BytesSpan in, protocols::pmr::Multicall3_Call3Value& out, Error* e=nullptr) {
+    auto fields = protocols::pmr::Multicall3_Call3Value::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1129,11 +1886,23 @@ template<> struct traits<protocols::ERC20_TransferEventData> {
     traits<S>::encode_tail(out, base, protocols::ERC20_TransferEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::ERC20_TransferEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::ERC20_TransferEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::ERC20_TransferEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1154,11 +1923,23 @@ template<> struct traits<protocols::ERC20_ApprovalEventData> {
     traits<S>::encode_tail(out, base, protocols::ERC20_ApprovalEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::ERC20_ApprovalEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::ERC20_ApprovalEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::ERC20_ApprovalEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1179,11 +1960,23 @@ template<> struct traits<protocols::UniswapV3Pool_BurnEventData> {
     traits<S>::encode_tail(out, base, protocols::UniswapV3Pool_BurnEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::UniswapV3Pool_BurnEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::UniswapV3Pool_BurnEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::UniswapV3Pool_BurnEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1204,11 +1997,23 @@ template<> struct traits<protocols::UniswapV3Pool_CollectEventData> {
     traits<S>::encode_tail(out, base, protocols::UniswapV3Pool_CollectEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::UniswapV3Pool_CollectEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::UniswapV3Pool_CollectEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::UniswapV3Pool_CollectEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1229,11 +2034,23 @@ template<> struct traits<protocols::UniswapV3Pool_CollectProtocolEventData> {
     traits<S>::encode_tail(out, base, protocols::UniswapV3Pool_CollectProtocolEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::UniswapV3Pool_CollectProtocolEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::UniswapV3Pool_CollectProtocolEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::UniswapV3Pool_CollectProtocolEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1254,11 +2071,23 @@ template<> struct traits<protocols::UniswapV3Pool_FlashEventData> {
     traits<S>::encode_tail(out, base, protocols::UniswapV3Pool_FlashEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::UniswapV3Pool_FlashEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::UniswapV3Pool_FlashEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::UniswapV3Pool_FlashEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1279,11 +2108,23 @@ template<> struct traits<protocols::UniswapV3Pool_IncreaseObservationCardinality
     traits<S>::encode_tail(out, base, protocols::UniswapV3Pool_IncreaseObservationCardinalityNextEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::UniswapV3Pool_IncreaseObservationCardinalityNextEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::UniswapV3Pool_IncreaseObservationCardinalityNextEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::UniswapV3Pool_IncreaseObservationCardinalityNextEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1304,11 +2145,23 @@ template<> struct traits<protocols::UniswapV3Pool_InitializeEventData> {
     traits<S>::encode_tail(out, base, protocols::UniswapV3Pool_InitializeEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::UniswapV3Pool_InitializeEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::UniswapV3Pool_InitializeEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::UniswapV3Pool_InitializeEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1329,11 +2182,23 @@ template<> struct traits<protocols::UniswapV3Pool_MintEventData> {
     traits<S>::encode_tail(out, base, protocols::UniswapV3Pool_MintEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::UniswapV3Pool_MintEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::UniswapV3Pool_MintEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::UniswapV3Pool_MintEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1354,11 +2219,23 @@ template<> struct traits<protocols::UniswapV3Pool_SetFeeProtocolEventData> {
     traits<S>::encode_tail(out, base, protocols::UniswapV3Pool_SetFeeProtocolEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::UniswapV3Pool_SetFeeProtocolEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::UniswapV3Pool_SetFeeProtocolEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::UniswapV3Pool_SetFeeProtocolEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1379,11 +2256,23 @@ template<> struct traits<protocols::UniswapV3Pool_SwapEventData> {
     traits<S>::encode_tail(out, base, protocols::UniswapV3Pool_SwapEventData::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::UniswapV3Pool_SwapEventData& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::UniswapV3Pool_SwapEventData::from_tuple(tmp);
-    return true;
+    auto fields = protocols::UniswapV3Pool_SwapEventData::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1404,11 +2293,23 @@ template<> struct traits<protocols::IUniswapV3Pool_Burn> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_Burn::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_Burn& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_Burn::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_Burn::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1429,11 +2330,23 @@ template<> struct traits<protocols::IUniswapV3Pool_Collect> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_Collect::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_Collect& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_Collect::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_Collect::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1454,11 +2367,23 @@ template<> struct traits<protocols::IUniswapV3Pool_CollectProtocol> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_CollectProtocol::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_CollectProtocol& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_CollectProtocol::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_CollectProtocol::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1479,11 +2404,23 @@ template<> struct traits<protocols::IUniswapV3Pool_Mint> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_Mint::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_Mint& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_Mint::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_Mint::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1504,11 +2441,23 @@ template<> struct traits<protocols::IUniswapV3Pool_Observations> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_Observations::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_Observations& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_Observations::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_Observations::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1529,11 +2478,39 @@ template<> struct traits<protocols::IUniswapV3Pool_Observe> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_Observe::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_Observe& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_Observe::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_Observe::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
+  }
+
+  // The allocator-aware twin encodes and decodes through its fields
+  static size_t tail_size(const protocols::pmr::IUniswapV3Pool_Observe& v) {
+    return traits<S>::tail_size(protocols::pmr::IUniswapV3Pool_Observe::tie(v));
+  }
+  static void encode_head(uint8_t* out32, size_t hi, const protocols::pmr::IUniswapV3Pool_Observe& v, size_t base) {
+    traits<S>::encode_head(out32, hi, protocols::pmr::IUniswapV3Pool_Observe::tie(v), base);
+  }
+  static void encode_tail(uint8_t* out, size_t base, const protocols::pmr::IUniswapV3Pool_Observe& v) {
+    traits<S>::encode_tail(out, base, protocols::pmr::IUniswapV3Pool_Observe::tie(v));
+  }
+  template <class P = checked>
+  static bool decode(BytesSpan in, protocols::pmr::IUniswapV3Pool_Observe& out, Error* e=nullptr) {
+    auto fields = protocols::pmr::IUniswapV3Pool_Observe::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1554,11 +2531,23 @@ template<> struct traits<protocols::IUniswapV3Pool_Positions> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_Positions::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_Positions& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_Positions::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_Positions::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1579,11 +2568,23 @@ template<> struct traits<protocols::IUniswapV3Pool_ProtocolFees> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_ProtocolFees::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_ProtocolFees& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_ProtocolFees::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_ProtocolFees::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1604,11 +2605,23 @@ template<> struct traits<protocols::IUniswapV3Pool_Slot0> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_Slot0::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_Slot0& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_Slot0::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_Slot0::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1629,11 +2642,23 @@ template<> struct traits<protocols::IUniswapV3Pool_SnapshotCumulativesInside> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_SnapshotCumulativesInside::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_SnapshotCumulativesInside& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_SnapshotCumulativesInside::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_SnapshotCumulativesInside::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1654,11 +2679,23 @@ template<> struct traits<protocols::IUniswapV3Pool_Swap> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_Swap::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_Swap& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_Swap::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_Swap::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1679,11 +2716,23 @@ template<> struct traits<protocols::IUniswapV3Pool_Ticks> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV3Pool_Ticks::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV3Pool_Ticks& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV3Pool_Ticks::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV3Pool_Ticks::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1704,11 +2753,39 @@ template<> struct traits<protocols::IMulticall_Aggregate> {
     traits<S>::encode_tail(out, base, protocols::IMulticall_Aggregate::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IMulticall_Aggregate& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IMulticall_Aggregate::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IMulticall_Aggregate::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
+  }
+
+  // The allocator-aware twin encodes and decodes through its fields
+  static size_t tail_size(const protocols::pmr::IMulticall_Aggregate& v) {
+    return traits<S>::tail_size(protocols::pmr::IMulticall_Aggregate::tie(v));
+  }
+  static void encode_head(uint8_t* out32, size_t hi, const protocols::pmr::IMulticall_Aggregate& v, size_t base) {
+    traits<S>::encode_head(out32, hi, protocols::pmr::IMulticall_Aggregate::tie(v), base);
+  }
+  static void encode_tail(uint8_t* out, size_t base, const protocols::pmr::IMulticall_Aggregate& v) {
+    traits<S>::encode_tail(out, base, protocols::pmr::IMulticall_Aggregate::tie(v));
+  }
+  template <class P = checked>
+  static bool decode(BytesSpan in, protocols::pmr::IMulticall_Aggregate& out, Error* e=nullptr) {
+    auto fields = protocols::pmr::IMulticall_Aggregate::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1729,11 +2806,39 @@ template<> struct traits<protocols::IMulticall_BlockAndAggregate> {
     traits<S>::encode_tail(out, base, protocols::IMulticall_BlockAndAggregate::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IMulticall_BlockAndAggregate& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IMulticall_BlockAndAggregate::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IMulticall_BlockAndAggregate::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
+  }
+
+  // The allocator-aware twin encodes and decodes through its fields
+  static size_t tail_size(const protocols::pmr::IMulticall_BlockAndAggregate& v) {
+    return traits<S>::tail_size(protocols::pmr::IMulticall_BlockAndAggregate::tie(v));
+  }
+  static void encode_head(uint8_t* out32, size_t hi, const protocols::pmr::IMulticall_BlockAndAggregate& v, size_t base) {
+    traits<S>::encode_head(out32, hi, protocols::pmr::IMulticall_BlockAndAggregate::tie(v), base);
+  }
+  static void encode_tail(uint8_t* out, size_t base, const protocols::pmr::IMulticall_BlockAndAggregate& v) {
+    traits<S>::encode_tail(out, base, protocols::pmr::IMulticall_BlockAndAggregate::tie(v));
+  }
+  template <class P = checked>
+  static bool decode(BytesSpan in, protocols::pmr::IMulticall_BlockAndAggregate& out, Error* e=nullptr) {
+    auto fields = protocols::pmr::IMulticall_BlockAndAggregate::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1754,11 +2859,39 @@ template<> struct traits<protocols::IMulticall_TryBlockAndAggregate> {
     traits<S>::encode_tail(out, base, protocols::IMulticall_TryBlockAndAggregate::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IMulticall_TryBlockAndAggregate& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IMulticall_TryBlockAndAggregate::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IMulticall_TryBlockAndAggregate::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
+  }
+
+  // The allocator-aware twin encodes and decodes through its fields
+  static size_t tail_size(const protocols::pmr::IMulticall_TryBlockAndAggregate& v) {
+    return traits<S>::tail_size(protocols::pmr::IMulticall_TryBlockAndAggregate::tie(v));
+  }
+  static void encode_head(uint8_t* out32, size_t hi, const protocols::pmr::IMulticall_TryBlockAndAggregate& v, size_t base) {
+    traits<S>::encode_head(out32, hi, protocols::pmr::IMulticall_TryBlockAndAggregate::tie(v), base);
+  }
+  static void encode_tail(uint8_t* out, size_t base, const protocols::pmr::IMulticall_TryBlockAndAggregate& v) {
+    traits<S>::encode_tail(out, base, protocols::pmr::IMulticall_TryBlockAndAggregate::tie(v));
+  }
+  template <class P = checked>
+  static bool decode(BytesSpan in, protocols::pmr::IMulticall_TryBlockAndAggregate& out, Error* e=nullptr) {
+    auto fields = protocols::pmr::IMulticall_TryBlockAndAggregate::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -1779,11 +2912,23 @@ template<> struct traits<protocols::IUniswapV2Router_AddLiquidity> {
     traits<S>::encode_tail(out, base, protocols::IUniswapV2Router_AddLiquidity::to_tuple(v));
   }
 
+  // Tuple-like values (e.g. std::tuple of references) encode without a copy
+  template <class V>
+  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }
+  template <class V>
+  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {
+    traits<S>::encode_head(out32, hi, v, base);
+  }
+  template <class V>
+  static void encode_tail(uint8_t* out, size_t base, const V& v) {
+    traits<S>::encode_tail(out, base, v);
+  }
+
+  // Decodes straight into the fields, reusing their storage
+  template <class P = checked>
   static bool decode(BytesSpan in, protocols::IUniswapV2Router_AddLiquidity& out, Error* e=nullptr) {
-    abi::value_of<S>::type tmp;
-    if (!traits<S>::decode(in, tmp, e)) return false;
-    out = protocols::IUniswapV2Router_AddLiquidity::from_tuple(tmp);
-    return true;
+    auto fields = protocols::IUniswapV2Router_AddLiquidity::tie(out);
+    return traits<S>::template decode<P>(in, fields, e);
   }
 };
 
@@ -2020,5 +3165,131 @@ using UniswapV2Router_GetAmountsOut = Fn<Sel_UniswapV2Router_getAmountsOut, dyn_
 struct Sel_UniswapV2Router_getAmountsIn { static constexpr std::array<uint8_t,4> value{{0x1f,0x00,0xca,0x74}}; }; // "getAmountsIn(uint256,address[])"
 using UniswapV2Router_GetAmountsIn = Fn<Sel_UniswapV2Router_getAmountsIn, dyn_array<uint_t<256>>, uint_t<256>, dyn_array<address20>>;
 
+// ==============================
+// Function index
+// ==============================
+
+// Every generated function, for selector-driven dispatch (abi/registry.h)
+struct FunctionInfo { std::array<uint8_t,4> selector; const char* name; const char* signature; };
+inline constexpr FunctionInfo all_functions[] = {
+    {Sel_ERC20_name::value, "ERC20_Name", "name()"},
+    {Sel_ERC20_approve::value, "ERC20_Approve", "approve(address,uint256)"},
+    {Sel_ERC20_totalSupply::value, "ERC20_TotalSupply", "totalSupply()"},
+    {Sel_ERC20_transferFrom::value, "ERC20_TransferFrom", "transferFrom(address,address,uint256)"},
+    {Sel_ERC20_decimals::value, "ERC20_Decimals", "decimals()"},
+    {Sel_ERC20_balanceOf::value, "ERC20_BalanceOf", "balanceOf(address)"},
+    {Sel_ERC20_symbol::value, "ERC20_Symbol", "symbol()"},
+    {Sel_ERC20_transfer::value, "ERC20_Transfer", "transfer(address,uint256)"},
+    {Sel_ERC20_allowance::value, "ERC20_Allowance", "allowance(address,address)"},
+    {Sel_UniswapV3Pool_burn::value, "UniswapV3Pool_Burn", "burn(int24,int24,uint128)"},
+    {Sel_UniswapV3Pool_collect::value, "UniswapV3Pool_Collect", "collect(address,int24,int24,uint128,uint128)"},
+    {Sel_UniswapV3Pool_collectProtocol::value, "UniswapV3Pool_CollectProtocol", "collectProtocol(address,uint128,uint128)"},
+    {Sel_UniswapV3Pool_factory::value, "UniswapV3Pool_Factory", "factory()"},
+    {Sel_UniswapV3Pool_fee::value, "UniswapV3Pool_Fee", "fee()"},
+    {Sel_UniswapV3Pool_feeGrowthGlobal0X128::value, "UniswapV3Pool_FeeGrowthGlobal0X128", "feeGrowthGlobal0X128()"},
+    {Sel_UniswapV3Pool_feeGrowthGlobal1X128::value, "UniswapV3Pool_FeeGrowthGlobal1X128", "feeGrowthGlobal1X128()"},
+    {Sel_UniswapV3Pool_flash::value, "UniswapV3Pool_Flash", "flash(address,uint256,uint256,bytes)"},
+    {Sel_UniswapV3Pool_increaseObservationCardinalityNext::value, "UniswapV3Pool_IncreaseObservationCardinalityNext", "increaseObservationCardinalityNext(uint16)"},
+    {Sel_UniswapV3Pool_initialize::value, "UniswapV3Pool_Initialize", "initialize(uint160)"},
+    {Sel_UniswapV3Pool_liquidity::value, "UniswapV3Pool_Liquidity", "liquidity()"},
+    {Sel_UniswapV3Pool_maxLiquidityPerTick::value, "UniswapV3Pool_MaxLiquidityPerTick", "maxLiquidityPerTick()"},
+    {Sel_UniswapV3Pool_mint::value, "UniswapV3Pool_Mint", "mint(address,int24,int24,uint128,bytes)"},
+    {Sel_UniswapV3Pool_observations::value, "UniswapV3Pool_Observations", "observations(uint256)"},
+    {Sel_UniswapV3Pool_observe::value, "UniswapV3Pool_Observe", "observe(uint32[])"},
+    {Sel_UniswapV3Pool_positions::value, "UniswapV3Pool_Positions", "positions(bytes32)"},
+    {Sel_UniswapV3Pool_protocolFees::value, "UniswapV3Pool_ProtocolFees", "protocolFees()"},
+    {Sel_UniswapV3Pool_setFeeProtocol::value, "UniswapV3Pool_SetFeeProtocol", "setFeeProtocol(uint8,uint8)"},
+    {Sel_UniswapV3Pool_slot0::value, "UniswapV3Pool_Slot0", "slot0()"},
+    {Sel_UniswapV3Pool_snapshotCumulativesInside::value, "UniswapV3Pool_SnapshotCumulativesInside", "snapshotCumulativesInside(int24,int24)"},
+    {Sel_UniswapV3Pool_swap::value, "UniswapV3Pool_Swap", "swap(address,bool,int256,uint160,bytes)"},
+    {Sel_UniswapV3Pool_tickBitmap::value, "UniswapV3Pool_TickBitmap", "tickBitmap(int16)"},
+    {Sel_UniswapV3Pool_tickSpacing::value, "UniswapV3Pool_TickSpacing", "tickSpacing()"},
+    {Sel_UniswapV3Pool_ticks::value, "UniswapV3Pool_Ticks", "ticks(int24)"},
+    {Sel_UniswapV3Pool_token0::value, "UniswapV3Pool_Token0", "token0()"},
+    {Sel_UniswapV3Pool_token1::value, "UniswapV3Pool_Token1", "token1()"},
+    {Sel_UniswapV3TickLens_getPopulatedTicksInWord::value, "UniswapV3TickLens_GetPopulatedTicksInWord", "getPopulatedTicksInWord(address,int16)"},
+    {Sel_Multicall_aggregate::value, "Multicall_Aggregate", "aggregate((address,bytes)[])"},
+    {Sel_Multicall_aggregate3::value, "Multicall_Aggregate3", "aggregate3((address,bool,bytes)[])"},
+    {Sel_Multicall_aggregate3Value::value, "Multicall_Aggregate3Value", "aggregate3Value((address,bool,uint256,bytes)[])"},
+    {Sel_Multicall_blockAndAggregate::value, "Multicall_BlockAndAggregate", "blockAndAggregate((address,bytes)[])"},
+    {Sel_Multicall_getBasefee::value, "Multicall_GetBasefee", "getBasefee()"},
+    {Sel_Multicall_getBlockHash::value, "Multicall_GetBlockHash", "getBlockHash(uint256)"},
+    {Sel_Multicall_getBlockNumber::value, "Multicall_GetBlockNumber", "getBlockNumber()"},
+    {Sel_Multicall_getChainId::value, "Multicall_GetChainId", "getChainId()"},
+    {Sel_Multicall_getCurrentBlockCoinbase::value, "Multicall_GetCurrentBlockCoinbase", "getCurrentBlockCoinbase()"},
+    {Sel_Multicall_getCurrentBlockDifficulty::value, "Multicall_GetCurrentBlockDifficulty", "getCurrentBlockDifficulty()"},
+    {Sel_Multicall_getCurrentBlockGasLimit::value, "Multicall_GetCurrentBlockGasLimit", "getCurrentBlockGasLimit()"},
+    {Sel_Multicall_getCurrentBlockTimestamp::value, "Multicall_GetCurrentBlockTimestamp", "getCurrentBlockTimestamp()"},
+    {Sel_Multicall_getEthBalance::value, "Multicall_GetEthBalance", "getEthBalance(address)"},
+    {Sel_Multicall_getLastBlockHash::value, "Multicall_GetLastBlockHash", "getLastBlockHash()"},
+    {Sel_Multicall_tryAggregate::value, "Multicall_TryAggregate", "tryAggregate(bool,(address,bytes)[])"},
+    {Sel_Multicall_tryBlockAndAggregate::value, "Multicall_TryBlockAndAggregate", "tryBlockAndAggregate(bool,(address,bytes)[])"},
+    {Sel_UniswapV2Router_addLiquidity::value, "UniswapV2Router_AddLiquidity", "addLiquidity(address,address,uint256,uint256,uint256,uint256,address,uint256)"},
+    {Sel_UniswapV2Router_swapExactETHForTokens::value, "UniswapV2Router_SwapExactETHForTokens", "swapExactETHForTokens(uint256,address[],address,uint256)"},
+    {Sel_UniswapV2Router_swapExactTokensForTokens::value, "UniswapV2Router_SwapExactTokensForTokens", "swapExactTokensForTokens(uint256,uint256,address[],address,uint256)"},
+    {Sel_UniswapV2Router_swapTokensForExactTokens::value, "UniswapV2Router_SwapTokensForExactTokens", "swapTokensForExactTokens(uint256,uint256,address[],address,uint256)"},
+    {Sel_UniswapV2Router_getAmountsOut::value, "UniswapV2Router_GetAmountsOut", "getAmountsOut(uint256,address[])"},
+    {Sel_UniswapV2Router_getAmountsIn::value, "UniswapV2Router_GetAmountsIn", "getAmountsIn(uint256,address[])"},
+};
+using AllFunctions = std::tuple<
+    ERC20_Name,
+    ERC20_Approve,
+    ERC20_TotalSupply,
+    ERC20_TransferFrom,
+    ERC20_Decimals,
+    ERC20_BalanceOf,
+    ERC20_Symbol,
+    ERC20_Transfer,
+    ERC20_Allowance,
+    UniswapV3Pool_Burn,
+    UniswapV3Pool_Collect,
+    UniswapV3Pool_CollectProtocol,
+    UniswapV3Pool_Factory,
+    UniswapV3Pool_Fee,
+    UniswapV3Pool_FeeGrowthGlobal0X128,
+    UniswapV3Pool_FeeGrowthGlobal1X128,
+    UniswapV3Pool_Flash,
+    UniswapV3Pool_IncreaseObservationCardinalityNext,
+    UniswapV3Pool_Initialize,
+    UniswapV3Pool_Liquidity,
+    UniswapV3Pool_MaxLiquidityPerTick,
+    UniswapV3Pool_Mint,
+    UniswapV3Pool_Observations,
+    UniswapV3Pool_Observe,
+    UniswapV3Pool_Positions,
+    UniswapV3Pool_ProtocolFees,
+    UniswapV3Pool_SetFeeProtocol,
+    UniswapV3Pool_Slot0,
+    UniswapV3Pool_SnapshotCumulativesInside,
+    UniswapV3Pool_Swap,
+    UniswapV3Pool_TickBitmap,
+    UniswapV3Pool_TickSpacing,
+    UniswapV3Pool_Ticks,
+    UniswapV3Pool_Token0,
+    UniswapV3Pool_Token1,
+    UniswapV3TickLens_GetPopulatedTicksInWord,
+    Multicall_Aggregate,
+    Multicall_Aggregate3,
+    Multicall_Aggregate3Value,
+    Multicall_BlockAndAggregate,
+    Multicall_GetBasefee,
+    Multicall_GetBlockHash,
+    Multicall_GetBlockNumber,
+    Multicall_GetChainId,
+    Multicall_GetCurrentBlockCoinbase,
+    Multicall_GetCurrentBlockDifficulty,
+    Multicall_GetCurrentBlockGasLimit,
+    Multicall_GetCurrentBlockTimestamp,
+    Multicall_GetEthBalance,
+    Multicall_GetLastBlockHash,
+    Multicall_TryAggregate,
+    Multicall_TryBlockAndAggregate,
+    UniswapV2Router_AddLiquidity,
+    UniswapV2Router_SwapExactETHForTokens,
+    UniswapV2Router_SwapExactTokensForTokens,
+    UniswapV2Router_SwapTokensForExactTokens,
+    UniswapV2Router_GetAmountsOut,
+    UniswapV2Router_GetAmountsIn>;
+
 } // namespace protocols
 } // namespace abi
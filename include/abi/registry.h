@@ -0,0 +1,279 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "dyn.h"
+#include "multicall.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Selector-indexed dispatch for raw transaction input. A Registry maps the
+// leading 4 bytes of calldata to an entry (name, signature, handler); the
+// handler decodes the arguments with the matching Fn<> or dyn::Function and
+// passes them to user code.
+//
+//   abi::Registry reg;
+//   reg.add_protocols();  // every Sel_* in protocols.h
+//   reg.on<abi::protocols::UniswapV2Router_SwapExactTokensForTokens>(
+//       [&](const cpp_int& in, const cpp_int& min_out, const auto& path,
+//           const auto& to, const cpp_int& deadline) { ... });
+//   reg.dispatch(tx_input);
+
+namespace abi {
+
+// Big-endian selector bytes as the uint32 key used by SelectorTable
+inline uint32_t selector_key(const uint8_t* p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) |
+           (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+inline uint32_t selector_key(const std::array<uint8_t, 4>& s) {
+    return selector_key(s.data());
+}
+
+// Open-addressed uint32 -> uint32 map. Slots are grouped by 8; a lookup
+// compares a whole group of keys at once (AVX2, or two SSE2 compares) and
+// moves to the next group only when the current one is full. Groups fill
+// front to back and entries are never erased, so the fill count of a group
+// doubles as its occupancy mask.
+class SelectorTable {
+public:
+    static constexpr uint32_t npos = ~uint32_t(0);
+    static constexpr size_t group_size = 8;
+
+    explicit SelectorTable(size_t expected = 64) {
+        rehash(expected);
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    // Insert key -> value; returns false (and keeps the old value) when the
+    // key is already present
+    bool insert(uint32_t key, uint32_t value) {
+        if (find(key) != npos) return false;
+        if (2 * (size_ + 1) > keys_.size()) rehash(2 * (size_ + 1));
+        place(key, value);
+        ++size_;
+        return true;
+    }
+
+    uint32_t find(uint32_t key) const {
+        size_t g = group_of(key);
+        for (;;) {
+            const size_t base = g * group_size;
+            const uint8_t fill = fill_[g];
+            const uint32_t hits =
+                match(keys_.data() + base, key) & ((1u << fill) - 1);
+            if (hits) return vals_[base + __builtin_ctz(hits)];
+            if (fill < group_size) return npos;
+            g = (g + 1) & group_mask_;
+        }
+    }
+
+private:
+    std::vector<uint32_t> keys_, vals_;
+    std::vector<uint8_t> fill_;
+    size_t group_mask_ = 0;
+    size_t size_ = 0;
+
+    size_t group_of(uint32_t key) const {
+        // Selectors are keccak output, but vanity-mined ones share prefixes;
+        // mix before masking
+        return size_t((key * 0x9e3779b1u) >> 7) & group_mask_;
+    }
+
+    // Bit i set when group[i] == key
+    static uint32_t match(const uint32_t* group, uint32_t key) {
+#if defined(__AVX2__)
+        const __m256i k = _mm256_set1_epi32(static_cast<int>(key));
+        const __m256i v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(group));
+        return static_cast<uint32_t>(_mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpeq_epi32(v, k))));
+#elif defined(__SSE2__)
+        const __m128i k = _mm_set1_epi32(static_cast<int>(key));
+        const __m128i lo =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        const __m128i hi =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(group + 4));
+        return static_cast<uint32_t>(
+            _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lo, k))) |
+            (_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(hi, k))) << 4));
+#else
+        uint32_t m = 0;
+        for (size_t i = 0; i < group_size; ++i)
+            m |= uint32_t(group[i] == key) << i;
+        return m;
+#endif
+    }
+
+    void place(uint32_t key, uint32_t value) {
+        size_t g = group_of(key);
+        while (fill_[g] == group_size) g = (g + 1) & group_mask_;
+        const size_t slot = g * group_size + fill_[g]++;
+        keys_[slot] = key;
+        vals_[slot] = value;
+    }
+
+    void rehash(size_t min_slots) {
+        size_t groups = 1;
+        while (groups * group_size < min_slots) groups <<= 1;
+        std::vector<uint32_t> old_keys = std::move(keys_);
+        std::vector<uint32_t> old_vals = std::move(vals_);
+        std::vector<uint8_t> old_fill = std::move(fill_);
+        keys_.assign(groups * group_size, 0);
+        vals_.assign(groups * group_size, npos);
+        fill_.assign(groups, 0);
+        group_mask_ = groups - 1;
+        for (size_t g = 0; g < old_fill.size(); ++g)
+            for (size_t i = 0; i < old_fill[g]; ++i)
+                place(old_keys[g * group_size + i],
+                      old_vals[g * group_size + i]);
+    }
+};
+
+class Registry {
+public:
+    // Receives the full calldata (selector included)
+    using Handler = std::function<bool(BytesSpan input, Error* e)>;
+
+    struct Entry {
+        std::array<uint8_t, 4> selector;
+        std::string name;
+        std::string signature;
+        Handler handler;  // empty: classify only
+    };
+
+    const std::vector<Entry>& entries() const {
+        return entries_;
+    }
+
+    // Add an entry; fails on a duplicate selector
+    bool add(const std::array<uint8_t, 4>& selector, std::string name,
+             std::string signature, Handler handler = {},
+             Error* e = nullptr) {
+        const uint32_t idx = static_cast<uint32_t>(entries_.size());
+        if (!table_.insert(selector_key(selector), idx)) {
+            if (e) e->set(ErrorCode::other, "registry: duplicate selector");
+            return false;
+        }
+        entries_.push_back(Entry{selector, std::move(name),
+                                 std::move(signature), std::move(handler)});
+        return true;
+    }
+
+    // Classification entries for every function in protocols.h; selectors
+    // already present are left alone. Returns the number added.
+    size_t add_protocols() {
+        size_t n = 0;
+        for (const auto& f : protocols::all_functions)
+            if (!find(f.selector)) n += add(f.selector, f.name, f.signature);
+        return n;
+    }
+
+    // Typed handler for a generated Fn<>: called as h(args...) with the
+    // decoded arguments (Fn::value types). h may return void or bool.
+    // Replaces the handler of an existing entry for the same selector.
+    template <class F, class H>
+    bool on(H h, Error* e = nullptr) {
+        Handler fn = [h = std::move(h)](BytesSpan in, Error* err) mutable {
+            typename F::args_t args;
+            if (!F::decode_call(in, args, err)) return false;
+            if constexpr (std::is_void_v<decltype(std::apply(h, args))>) {
+                std::apply(h, args);
+                return true;
+            } else {
+                return static_cast<bool>(std::apply(h, args));
+            }
+        };
+        if (Entry* ent = find_mut(F::selector::value)) {
+            ent->handler = std::move(fn);
+            return true;
+        }
+        const protocols::FunctionInfo* info = nullptr;
+        for (const auto& f : protocols::all_functions)
+            if (f.selector == F::selector::value) info = &f;
+        return add(F::selector::value, info ? info->name : "",
+                   info ? info->signature : "", std::move(fn), e);
+    }
+
+    // Runtime-registered function: h(function, args) with the decoded
+    // argument list. The function is copied into the registry.
+    template <class H>
+    bool on(const dyn::Function& f, H h, Error* e = nullptr) {
+        Handler fn = [f, h = std::move(h)](BytesSpan in, Error* err) mutable {
+            dyn::Value::List args;
+            if (!f.decode_call(in, args, err)) return false;
+            if constexpr (std::is_void_v<decltype(h(f, args))>) {
+                h(f, args);
+                return true;
+            } else {
+                return static_cast<bool>(h(f, args));
+            }
+        };
+        if (Entry* ent = find_mut(f.selector)) {
+            ent->handler = std::move(fn);
+            return true;
+        }
+        return add(f.selector, f.name, f.signature, std::move(fn), e);
+    }
+
+    const Entry* find(const std::array<uint8_t, 4>& selector) const {
+        const uint32_t idx = table_.find(selector_key(selector));
+        return idx == SelectorTable::npos ? nullptr : &entries_[idx];
+    }
+
+    // Entry for raw calldata; nullptr when shorter than 4 bytes or unknown
+    const Entry* find(BytesSpan input) const {
+        if (input.size() < 4) return nullptr;
+        const uint32_t idx = table_.find(selector_key(input.data()));
+        return idx == SelectorTable::npos ? nullptr : &entries_[idx];
+    }
+
+    // Look up input and run its handler. Returns false for unknown
+    // selectors, decode failures and handlers returning false; entries
+    // without a handler only classify and return true.
+    bool dispatch(BytesSpan input, Error* e = nullptr) const {
+        const Entry* ent = find(input);
+        if (!ent) {
+            if (e)
+                e->set(ErrorCode::selector_mismatch,
+                       "registry: unknown selector");
+            return false;
+        }
+        return !ent->handler || ent->handler(input, e);
+    }
+
+    // Dispatch the calls wrapped in (possibly nested) multicall calldata;
+    // input that is not a multicall is dispatched directly. Inner calls
+    // with unknown selectors are skipped. Returns false on malformed
+    // multicall data, decode failures or handlers returning false.
+    bool dispatch_nested(BytesSpan input, size_t max_depth = 4,
+                         Error* e = nullptr) const {
+        if (!multicall::CallsView::is_multicall(input))
+            return dispatch(input, e);
+        return multicall::for_each_call(
+            input,
+            [&](const multicall::CallRef& c, size_t) {
+                const Entry* ent = find(c.callData);
+                return !ent || !ent->handler || ent->handler(c.callData, e);
+            },
+            max_depth, e);
+    }
+
+private:
+    SelectorTable table_;
+    std::vector<Entry> entries_;
+
+    Entry* find_mut(const std::array<uint8_t, 4>& selector) {
+        const uint32_t idx = table_.find(selector_key(selector));
+        return idx == SelectorTable::npos ? nullptr : &entries_[idx];
+    }
+};
+
+}  // namespace abi
@@ -0,0 +1,277 @@
+#pragma once
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "abi.h"
+
+// Allocation-free decimal formatting and parsing for the native u256 (and
+// cpp_int values within 256 bits), so amounts can be logged or ingested
+// without going through Boost's string conversion, plus correctly rounded
+// conversion to double.
+
+namespace abi {
+
+// Magnitude of x; false when it needs more than 256 bits (the sign is the
+// caller's business)
+inline bool u256_from_cpp_int(const boost::multiprecision::cpp_int& x,
+                              u256& out) {
+    const auto& be = x.backend();
+    using limb_t = std::decay_t<decltype(*be.limbs())>;
+    constexpr size_t per = sizeof(limb_t) * 8;
+    size_t top = be.size();
+    while (top && be.limbs()[top - 1] == 0) --top;
+    if (top * per > 256) return false;
+    out = u256{};
+    for (size_t i = 0; i < top; ++i)
+        out.limbs[i * per / 64] |= uint64_t(be.limbs()[i]) << ((i * per) % 64);
+    return true;
+}
+
+namespace u256_detail {
+
+struct DigitPairs {
+    char v[200];
+    constexpr DigitPairs() : v{} {
+        for (int i = 0; i < 100; ++i) {
+            v[2 * i] = static_cast<char>('0' + i / 10);
+            v[2 * i + 1] = static_cast<char>('0' + i % 10);
+        }
+    }
+};
+inline constexpr DigitPairs digit_pairs{};
+
+inline constexpr uint64_t pow10[20] = {1ULL,
+                                       10ULL,
+                                       100ULL,
+                                       1000ULL,
+                                       10000ULL,
+                                       100000ULL,
+                                       1000000ULL,
+                                       10000000ULL,
+                                       100000000ULL,
+                                       1000000000ULL,
+                                       10000000000ULL,
+                                       100000000000ULL,
+                                       1000000000000ULL,
+                                       10000000000000ULL,
+                                       100000000000000ULL,
+                                       1000000000000000ULL,
+                                       10000000000000000ULL,
+                                       100000000000000000ULL,
+                                       1000000000000000000ULL,
+                                       10000000000000000000ULL};
+
+// Exactly n digits of x (x < 10^n), two at a time from the right
+inline void fixed_digits(char* out, uint64_t x, size_t n) {
+    while (n >= 2) {
+        std::memcpy(out + n - 2, digit_pairs.v + 2 * (x % 100), 2);
+        x /= 100;
+        n -= 2;
+    }
+    if (n) out[0] = static_cast<char>('0' + x);
+}
+
+inline size_t u64_digits(uint64_t x) {
+    size_t n = 1;
+    while (n < 20 && x >= pow10[n]) ++n;
+    return n;
+}
+
+// Eight ASCII digits (first at the lowest address) -> value; false when any
+// byte is not '0'..'9'
+inline bool swar8(const char* p, uint64_t& out) {
+    uint64_t c;
+    std::memcpy(&c, p, 8);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    c = __builtin_bswap64(c);
+#endif
+    if (((c & 0xf0f0f0f0f0f0f0f0ULL) |
+         (((c + 0x0606060606060606ULL) & 0xf0f0f0f0f0f0f0f0ULL) >> 4)) !=
+        0x3333333333333333ULL)
+        return false;
+    c -= 0x3030303030303030ULL;
+    c = (c * 10 + (c >> 8)) & 0x00ff00ff00ff00ffULL;
+    c = (c * 100 + (c >> 16)) & 0x0000ffff0000ffffULL;
+    out = (c * 10000 + (c >> 32)) & 0xffffffffULL;
+    return true;
+}
+
+// n <= 19 digits -> value; on failure bad is the index of the first
+// non-digit
+inline bool parse_digits(const char* p, size_t n, uint64_t& out, size_t& bad) {
+    uint64_t v = 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t chunk;
+        if (!swar8(p + i, chunk)) break;
+        v = v * 100000000ULL + chunk;
+    }
+    for (; i < n; ++i) {
+        const unsigned d = static_cast<unsigned char>(p[i]) - '0';
+        if (d > 9) {
+            bad = i;
+            return false;
+        }
+        v = v * 10 + d;
+    }
+    out = v;
+    return true;
+}
+
+// v = v * m + a; false on overflow past 256 bits
+inline bool mul_add(u256& v, uint64_t m, uint64_t a) {
+    uint64_t carry = a;
+    for (int i = 0; i < 4; ++i) {
+#ifdef __SIZEOF_INT128__
+        const unsigned __int128 t =
+            static_cast<unsigned __int128>(v.limbs[i]) * m + carry;
+        v.limbs[i] = static_cast<uint64_t>(t);
+        carry = static_cast<uint64_t>(t >> 64);
+#else
+        const uint64_t a0 = v.limbs[i] & 0xffffffffULL, a1 = v.limbs[i] >> 32;
+        const uint64_t m0 = m & 0xffffffffULL, m1 = m >> 32;
+        const uint64_t p00 = a0 * m0, p01 = a0 * m1, p10 = a1 * m0,
+                       p11 = a1 * m1;
+        const uint64_t mid = (p00 >> 32) + (p01 & 0xffffffffULL) +
+                             (p10 & 0xffffffffULL);
+        uint64_t lo = (mid << 32) | (p00 & 0xffffffffULL);
+        uint64_t hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+        lo += carry;
+        hi += lo < carry;
+        v.limbs[i] = lo;
+        carry = hi;
+#endif
+    }
+    return carry == 0;
+}
+
+}  // namespace u256_detail
+
+// Longest decimal form of a u256 (2^256 - 1 has 78 digits)
+inline constexpr size_t u256_max_decimal = 78;
+
+// Decimal digits of v into out (room for u256_max_decimal chars, no
+// terminator); returns the length. Splits v into base-10^19 parts by limb
+// division and prints each part two digits at a time.
+inline size_t u256_to_decimal(char* out, const u256& v) {
+    using namespace u256_detail;
+    if ((v.limbs[1] | v.limbs[2] | v.limbs[3]) == 0) {
+        const size_t n = u64_digits(v.limbs[0]);
+        fixed_digits(out, v.limbs[0], n);
+        return n;
+    }
+#ifdef __SIZEOF_INT128__
+    constexpr uint64_t base = pow10[19];
+    u256 q = v;
+    uint64_t parts[5];
+    size_t np = 0;
+    size_t top = 4;
+    while (top) {
+        unsigned __int128 rem = 0;
+        for (size_t i = top; i-- > 0;) {
+            const unsigned __int128 cur = (rem << 64) | q.limbs[i];
+            q.limbs[i] = static_cast<uint64_t>(cur / base);
+            rem = cur % base;
+        }
+        parts[np++] = static_cast<uint64_t>(rem);
+        while (top && q.limbs[top - 1] == 0) --top;
+    }
+    size_t len = u64_digits(parts[np - 1]);
+    fixed_digits(out, parts[np - 1], len);
+    for (size_t p = np - 1; p-- > 0; len += 19)
+        fixed_digits(out + len, parts[p], 19);
+    return len;
+#else
+    const std::string s = v.to_cpp_int().str();
+    std::memcpy(out, s.data(), s.size());
+    return s.size();
+#endif
+}
+
+// cpp_int form; returns 0 (writes nothing) when x is negative or wider than
+// 256 bits
+inline size_t u256_to_decimal(char* out,
+                              const boost::multiprecision::cpp_int& x) {
+    u256 v;
+    if (x.sign() < 0 || !u256_from_cpp_int(x, v)) return 0;
+    return u256_to_decimal(out, v);
+}
+
+// Parse plain decimal digits (no sign, no whitespace; leading zeros are
+// fine) into out. Eight digits are checked and combined per step as one
+// 64-bit word. Error::offset is the index of the first non-digit.
+inline bool u256_from_decimal(std::string_view s, u256& out,
+                              Error* e = nullptr) {
+    using namespace u256_detail;
+    if (s.empty()) {
+        if (e) e->set(ErrorCode::invalid_text, "decimal: empty");
+        return false;
+    }
+    u256 v;
+    size_t i = 0;
+    size_t n = s.size() % 19;  // first group is the short one
+    if (n == 0) n = 19;
+    for (; i < s.size(); i += n, n = 19) {
+        uint64_t g = 0;
+        size_t bad = 0;
+        if (!parse_digits(s.data() + i, n, g, bad)) {
+            if (e)
+                e->set(ErrorCode::invalid_text,
+                       "decimal: invalid character", i + bad);
+            return false;
+        }
+        if (!mul_add(v, pow10[n], g)) {
+            if (e) e->set(ErrorCode::out_of_range, "decimal: overflow");
+            return false;
+        }
+    }
+    out = v;
+    return true;
+}
+
+inline bool u256_from_decimal(std::string_view s,
+                              boost::multiprecision::cpp_int& out,
+                              Error* e = nullptr) {
+    u256 v;
+    if (!u256_from_decimal(s, v, e)) return false;
+    out = v.to_cpp_int();
+    return true;
+}
+
+// Nearest double to v (ties to even). The top 64 significant bits are
+// converted in one rounding step with every lower bit folded into a sticky
+// bit, then scaled by a power of two (exact).
+inline double u256_to_double(const u256& v) {
+    int top = 3;
+    while (top > 0 && v.limbs[top] == 0) --top;
+    if (top == 0) return static_cast<double>(v.limbs[0]);
+    const int lz = __builtin_clzll(v.limbs[top]);
+    uint64_t hi = v.limbs[top] << lz;
+    uint64_t rest = v.limbs[top - 1];
+    if (lz) {
+        hi |= rest >> (64 - lz);
+        rest <<= lz;
+    }
+    for (int i = top - 2; i >= 0; --i) rest |= v.limbs[i];
+    hi |= rest != 0;  // below the rounding bit, so only breaks ties
+    // 2^(64 * top - lz), at most 2^192: build the exponent field directly
+    const uint64_t bits = uint64_t(1023 + 64 * top - lz) << 52;
+    double scale;
+    std::memcpy(&scale, &bits, 8);
+    return static_cast<double>(hi) * scale;
+}
+
+// v read as a two's-complement int256
+inline double i256_to_double(const u256& v) {
+    if (!(v.limbs[3] >> 63)) return u256_to_double(v);
+    u256 m;
+    unsigned carry = 1;
+    for (int i = 0; i < 4; ++i) {
+        m.limbs[i] = ~v.limbs[i] + carry;
+        carry = carry && m.limbs[i] == 0;
+    }
+    return -u256_to_double(m);
+}
+
+}  // namespace abi
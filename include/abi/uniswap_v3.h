@@ -0,0 +1,354 @@
+#pragma once
+#include "multicall.h"
+#include "u256.h"
+
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Hand-tuned decoders for hot Uniswap V3 responses. They produce native
+// integers instead of cpp_int.
+
+namespace abi {
+namespace uniswap_v3 {
+
+namespace detail {
+
+// True when the first n bytes of w all equal fill (0x00 or 0xff)
+inline bool all_fill(const uint8_t* w, size_t n, uint8_t fill) {
+    uint64_t acc = 0;
+    const uint64_t f = fill ? ~uint64_t(0) : 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t x;
+        std::memcpy(&x, w + i, 8);
+        acc |= x ^ f;
+    }
+    for (; i < n; ++i) acc |= uint8_t(w[i] ^ fill);
+    return acc == 0;
+}
+
+inline uint32_t load_be32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return __builtin_bswap32(v);
+}
+
+}  // namespace detail
+
+// ----------------- Pool slot0() -----------------
+
+// Native layout of IUniswapV3Pool_Slot0
+struct Slot0 {
+    u256 sqrtPriceX96;  // uint160
+    int32_t tick;       // int24
+    uint16_t observationIndex;
+    uint16_t observationCardinality;
+    uint16_t observationCardinalityNext;
+    uint8_t feeProtocol;
+    bool unlocked;
+};
+
+// Decode a slot0() return payload (7 static words). Values that do not fit
+// their declared widths are rejected.
+inline bool decode_slot0(BytesSpan in, Slot0& out, Error* e = nullptr) {
+    if (in.size() < 7 * 32) {
+        if (e) e->set(ErrorCode::short_input, "slot0: short");
+        return false;
+    }
+    const uint8_t* p = in.data();
+    const uint8_t tfill = (p[32 + 29] & 0x80) ? 0xff : 0x00;
+    const bool ok = detail::all_fill(p, 12, 0) &
+                    detail::all_fill(p + 32, 29, tfill) &
+                    detail::all_fill(p + 64, 30, 0) &
+                    detail::all_fill(p + 96, 30, 0) &
+                    detail::all_fill(p + 128, 30, 0) &
+                    detail::all_fill(p + 160, 31, 0) &
+                    detail::all_fill(p + 192, 31, 0);
+    if (!ok) {
+        if (e) e->set(ErrorCode::out_of_range, "slot0: value out of range");
+        return false;
+    }
+    out.sqrtPriceX96 = u256::from_be(p);
+    out.tick = static_cast<int32_t>(detail::load_be32(p + 32 + 28));
+    out.observationIndex =
+        static_cast<uint16_t>((p[64 + 30] << 8) | p[64 + 31]);
+    out.observationCardinality =
+        static_cast<uint16_t>((p[96 + 30] << 8) | p[96 + 31]);
+    out.observationCardinalityNext =
+        static_cast<uint16_t>((p[128 + 30] << 8) | p[128 + 31]);
+    out.feeProtocol = p[160 + 31];
+    out.unlocked = p[192 + 31] != 0;
+    return true;
+}
+
+// Decode one Slot0 per aggregate3 / tryAggregate result entry.
+// success[i] is false when the call reverted or its data failed to decode.
+inline void decode_slot0_batch(const multicall::ResultsView& results,
+                               std::vector<Slot0>& out,
+                               std::vector<bool>& success) {
+    out.resize(results.size());
+    success.resize(results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto r = results[i];
+        success[i] = r.success && decode_slot0(r.returnData, out[i]);
+    }
+}
+
+// Same, starting from the raw aggregate3 / tryAggregate return payload
+inline bool decode_slot0_batch(BytesSpan in, std::vector<Slot0>& out,
+                               std::vector<bool>& success,
+                               Error* e = nullptr) {
+    multicall::ResultsView view;
+    if (!multicall::ResultsView::parse(in, view, e)) return false;
+    decode_slot0_batch(view, out, success);
+    return true;
+}
+
+// ----------------- sqrtPriceX96 -> price -----------------
+
+namespace detail {
+
+// out[i] = (out[i] * k)^2 over doubles already holding sqrtPriceX96
+inline void square_scaled(double* out, size_t n, double k, double scale) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256d k4 = _mm256_set1_pd(k), s4 = _mm256_set1_pd(scale);
+    for (; i + 4 <= n; i += 4) {
+        const __m256d r = _mm256_mul_pd(_mm256_loadu_pd(out + i), k4);
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_mul_pd(r, r), s4));
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128d k2 = _mm_set1_pd(k), s2 = _mm_set1_pd(scale);
+    for (; i + 2 <= n; i += 2) {
+        const __m128d r = _mm_mul_pd(_mm_loadu_pd(out + i), k2);
+        _mm_storeu_pd(out + i, _mm_mul_pd(_mm_mul_pd(r, r), s2));
+    }
+#endif
+    for (; i < n; ++i) {
+        const double r = out[i] * k;
+        out[i] = r * r * scale;
+    }
+}
+
+}  // namespace detail
+
+// token1-per-token0 price of one pool: (sqrtPriceX96 / 2^96)^2 * scale, with
+// scale = 10^(decimals0 - decimals1) for human units. sqrtPriceX96 is
+// rounded to double once (exactly), so the result is within ~2 ulp.
+inline double sqrt_price_x96_to_price(const u256& sqrtPriceX96,
+                                      double scale = 1.0) {
+    const double r = u256_to_double(sqrtPriceX96) * 0x1p-96;
+    return r * r * scale;
+}
+
+// Column form: out[i] = price of sqrtPriceX96[i]. The per-value conversion
+// needs a normalising shift per element and runs scalar; scaling and
+// squaring run 4 (AVX2) or 2 (SSE2) lanes at a time.
+inline void sqrt_price_x96_to_price(const u256* sqrtPriceX96, size_t n,
+                                    double* out, double scale = 1.0) {
+    for (size_t i = 0; i < n; ++i) out[i] = u256_to_double(sqrtPriceX96[i]);
+    detail::square_scaled(out, n, 0x1p-96, scale);
+}
+
+// Over decoded slot0() states (e.g. from decode_slot0_batch); out needs
+// states.size() entries
+inline void sqrt_price_x96_to_price(const std::vector<Slot0>& states,
+                                    double* out, double scale = 1.0) {
+    for (size_t i = 0; i < states.size(); ++i)
+        out[i] = u256_to_double(states[i].sqrtPriceX96);
+    detail::square_scaled(out, states.size(), 0x1p-96, scale);
+}
+
+#ifdef __SIZEOF_INT128__
+using int128 = __int128;
+using uint128 = unsigned __int128;
+
+namespace detail {
+
+// Big-endian 16 bytes -> native 128-bit integer
+inline uint128 load_be128(const uint8_t* p) {
+#if defined(__SSSE3__) || defined(__AVX2__)
+    const __m128i rev =
+        _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    v = _mm_shuffle_epi8(v, rev);
+    uint128 out;
+    std::memcpy(&out, &v, 16);
+    return out;
+#else
+    uint64_t hi, lo;
+    std::memcpy(&hi, p, 8);
+    std::memcpy(&lo, p + 8, 8);
+    return (uint128(__builtin_bswap64(hi)) << 64) | __builtin_bswap64(lo);
+#endif
+}
+
+}  // namespace detail
+
+// ----------------- TickLens getPopulatedTicksInWord -----------------
+
+// Structure-of-arrays view of PopulatedTick[]
+struct TickColumns {
+    std::vector<int32_t> tick;
+    std::vector<int128> liquidityNet;
+    std::vector<uint128> liquidityGross;
+
+    size_t size() const {
+        return tick.size();
+    }
+    void clear() {
+        tick.clear();
+        liquidityNet.clear();
+        liquidityGross.clear();
+    }
+};
+
+// Decode the PopulatedTick[] array body (starting at the length word) into
+// caller-provided columns with room for cap entries; n receives the count.
+// Words must be canonically sign/zero extended; out-of-range values are
+// rejected.
+inline bool decode_populated_ticks_body(BytesSpan in, size_t& n,
+                                        int32_t* tick, int128* net,
+                                        uint128* gross, size_t cap,
+                                        Error* e = nullptr) {
+    size_t len = 0;
+    if (in.size() < 32 || !read_size_word(in.data(), len)) {
+        if (e) e->set(ErrorCode::short_input, "ticks: short");
+        return false;
+    }
+    if (len > (in.size() - 32) / 96) {
+        if (e) e->set(ErrorCode::short_input, "ticks: inline short");
+        return false;
+    }
+    if (len > cap) {
+        if (e) e->set(ErrorCode::buffer_too_small, "ticks: output too small");
+        return false;
+    }
+    const uint8_t* p = in.data() + 32;
+    bool ok = true;
+    for (size_t i = 0; i < len; ++i, p += 96) {
+        // int24 tick: sign fill in bytes [0,29), value in [29,32)
+        const uint8_t tfill = (p[29] & 0x80) ? 0xff : 0x00;
+        // int128 liquidityNet: sign fill in [32,48); uint128 gross: [64,80)
+        const uint8_t nfill = (p[48] & 0x80) ? 0xff : 0x00;
+        ok &= detail::all_fill(p, 29, tfill) &
+              detail::all_fill(p + 32, 16, nfill) &
+              detail::all_fill(p + 64, 16, 0);
+        tick[i] = static_cast<int32_t>(detail::load_be32(p + 28));
+        net[i] = static_cast<int128>(detail::load_be128(p + 48));
+        gross[i] = detail::load_be128(p + 80);
+    }
+    if (!ok) {
+        if (e) e->set(ErrorCode::out_of_range, "ticks: value out of range");
+        return false;
+    }
+    n = len;
+    return true;
+}
+
+// Decode a getPopulatedTicksInWord return payload, appending to cols so
+// that many words / pools can be collected into one set of columns
+inline bool decode_populated_ticks(BytesSpan in, TickColumns& cols,
+                                   Error* e = nullptr) {
+    size_t off = 0;
+    if (in.size() < 32 || !read_size_word(in.data(), off) ||
+        off > in.size()) {
+        if (e) e->set(ErrorCode::bad_offset, "top: bad off");
+        return false;
+    }
+    const BytesSpan body(in.data() + off, in.size() - off);
+    size_t len = 0;
+    if (body.size() < 32 || !read_size_word(body.data(), len) ||
+        len > (body.size() - 32) / 96) {
+        if (e) e->set(ErrorCode::short_input, "ticks: inline short");
+        return false;
+    }
+    const size_t base = cols.size();
+    cols.tick.resize(base + len);
+    cols.liquidityNet.resize(base + len);
+    cols.liquidityGross.resize(base + len);
+    size_t n = 0;
+    if (!decode_populated_ticks_body(body, n, cols.tick.data() + base,
+                                     cols.liquidityNet.data() + base,
+                                     cols.liquidityGross.data() + base, len,
+                                     e)) {
+        cols.tick.resize(base);
+        cols.liquidityNet.resize(base);
+        cols.liquidityGross.resize(base);
+        return false;
+    }
+    return true;
+}
+
+// ----------------- Pool Swap event -----------------
+
+// Structure-of-arrays view of Swap event data. Amounts keep their raw
+// two's-complement words; read them with i256_to_double or
+// u256::to_cpp_int (then sign_extend<256>).
+struct SwapColumns {
+    std::vector<u256> amount0;
+    std::vector<u256> amount1;
+    std::vector<u256> sqrtPriceX96;  // uint160
+    std::vector<uint128> liquidity;
+    std::vector<int32_t> tick;
+
+    size_t size() const {
+        return tick.size();
+    }
+    void clear() {
+        amount0.clear();
+        amount1.clear();
+        sqrtPriceX96.clear();
+        liquidity.clear();
+        tick.clear();
+    }
+};
+
+// Append the non-indexed data of one Swap log (amount0, amount1,
+// sqrtPriceX96, liquidity, tick: 5 static words) to cols
+inline bool decode_swap(BytesSpan data, SwapColumns& cols, Error* e = nullptr) {
+    if (data.size() < 5 * 32) {
+        if (e) e->set(ErrorCode::short_input, "swap: short");
+        return false;
+    }
+    const uint8_t* p = data.data();
+    const uint8_t tfill = (p[128 + 29] & 0x80) ? 0xff : 0x00;
+    if (!(detail::all_fill(p + 64, 12, 0) & detail::all_fill(p + 96, 16, 0) &
+          detail::all_fill(p + 128, 29, tfill))) {
+        if (e) e->set(ErrorCode::out_of_range, "swap: value out of range");
+        return false;
+    }
+    cols.amount0.push_back(u256::from_be(p));
+    cols.amount1.push_back(u256::from_be(p + 32));
+    cols.sqrtPriceX96.push_back(u256::from_be(p + 64));
+    cols.liquidity.push_back(detail::load_be128(p + 112));
+    cols.tick.push_back(static_cast<int32_t>(detail::load_be32(p + 128 + 28)));
+    return true;
+}
+
+// Post-swap prices of every row in cols into out[cols.size()]
+inline void sqrt_price_x96_to_price(const SwapColumns& cols, double* out,
+                                    double scale = 1.0) {
+    sqrt_price_x96_to_price(cols.sqrtPriceX96.data(), cols.size(), out, scale);
+}
+
+// ----------------- Pool liquidity() -----------------
+
+inline bool decode_liquidity(BytesSpan in, uint128& out, Error* e = nullptr) {
+    if (in.size() < 32) {
+        if (e) e->set(ErrorCode::short_input, "liquidity: short");
+        return false;
+    }
+    if (!detail::all_fill(in.data(), 16, 0)) {
+        if (e) e->set(ErrorCode::out_of_range, "liquidity: value out of range");
+        return false;
+    }
+    out = detail::load_be128(in.data() + 16);
+    return true;
+}
+#endif  // __SIZEOF_INT128__
+
+}  // namespace uniswap_v3
+}  // namespace abi
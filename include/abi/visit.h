@@ -0,0 +1,339 @@
+#pragma once
+#include "abi.h"
+
+// Streaming (SAX-style) decoding: abi::visit<Schema>(in, visitor) walks an
+// encoded payload and reports every container and leaf to the visitor with
+// borrowed values. Nothing is allocated; dyn_array elements are visited in
+// place instead of being decoded into a std::vector first.
+//
+// Visitor interface (derive from abi::Visitor to get no-op defaults):
+//   bool begin_array(size_t idx, size_t n);   // dyn_array / static_array
+//   bool end_array();
+//   bool begin_tuple(size_t idx);
+//   bool end_tuple();
+//   bool value(Schema, size_t idx, Borrowed);  // one per leaf
+// idx is the position inside the enclosing tuple or array (0 at top level).
+// Borrowed is Word for uint_t/int_t, bool for bool_t, a 20-byte BytesSpan
+// for address20, BytesSpan for bytes and std::string_view for string_t.
+// Any callback returning false stops the walk early.
+
+namespace abi {
+
+// Borrowed 32-byte big-endian word. Narrow accessors assume a canonical
+// encoding (zero / sign extended), as produced by any compliant encoder.
+struct Word {
+    const uint8_t* data;
+
+    uint64_t u64() const {
+        uint64_t v = 0;
+        for (int i = 24; i < 32; ++i) v = (v << 8) | data[i];
+        return v;
+    }
+    int64_t i64() const {
+        return static_cast<int64_t>(u64());
+    }
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 u128() const {
+        unsigned __int128 v = 0;
+        for (int i = 16; i < 32; ++i) v = (v << 8) | data[i];
+        return v;
+    }
+    __int128 i128() const {
+        return static_cast<__int128>(u128());
+    }
+#endif
+    boost::multiprecision::cpp_int big() const {
+        return read_u256_big(data);
+    }
+};
+
+// No-op visitor. Derived visitors that declare their own value() overloads
+// should add `using abi::Visitor::value;` to keep the catch-all.
+struct Visitor {
+    bool begin_array(size_t, size_t) {
+        return true;
+    }
+    bool end_array() {
+        return true;
+    }
+    bool begin_tuple(size_t) {
+        return true;
+    }
+    bool end_tuple() {
+        return true;
+    }
+    template <class Schema, class T>
+    bool value(Schema, size_t, const T&) {
+        return true;
+    }
+};
+
+// Per-schema walkers; `in` starts at the encoding of the value, exactly as
+// for traits<Schema>::decode
+template <class Schema>
+struct visit_traits;
+
+template <>
+struct visit_traits<bool_t> {
+    template <class V>
+    static bool walk(BytesSpan in, size_t idx, V& v, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "bool: short");
+            return false;
+        }
+        return v.value(bool_t{}, idx, in.data()[31] != 0);
+    }
+};
+
+template <>
+struct visit_traits<address20> {
+    template <class V>
+    static bool walk(BytesSpan in, size_t idx, V& v, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "address: short");
+            return false;
+        }
+        return v.value(address20{}, idx, BytesSpan(in.data() + 12, 20));
+    }
+};
+
+template <int N>
+struct visit_traits<uint_t<N>> {
+    template <class V>
+    static bool walk(BytesSpan in, size_t idx, V& v, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "uintN: short");
+            return false;
+        }
+        return v.value(uint_t<N>{}, idx, Word{in.data()});
+    }
+};
+
+template <int N>
+struct visit_traits<int_t<N>> {
+    template <class V>
+    static bool walk(BytesSpan in, size_t idx, V& v, Error* e) {
+        if (in.size() < 32) {
+            if (e) e->set(ErrorCode::short_input, "intN: short");
+            return false;
+        }
+        return v.value(int_t<N>{}, idx, Word{in.data()});
+    }
+};
+
+template <>
+struct visit_traits<bytes> {
+    template <class V>
+    static bool walk(BytesSpan in, size_t idx, V& v, Error* e) {
+        size_t len = 0;
+        if (in.size() < 32 || !read_size_word(in.data(), len)) {
+            if (e) e->set(ErrorCode::short_input, "bytes: short");
+            return false;
+        }
+        if (len > in.size() - 32) {
+            if (e) e->set(ErrorCode::out_of_range, "bytes: len out of range");
+            return false;
+        }
+        return v.value(bytes{}, idx, BytesSpan(in.data() + 32, len));
+    }
+};
+
+template <>
+struct visit_traits<string_t> {
+    template <class V>
+    static bool walk(BytesSpan in, size_t idx, V& v, Error* e) {
+        size_t len = 0;
+        if (in.size() < 32 || !read_size_word(in.data(), len)) {
+            if (e) e->set(ErrorCode::short_input, "string: short");
+            return false;
+        }
+        if (len > in.size() - 32) {
+            if (e) e->set(ErrorCode::out_of_range, "string: len out of range");
+            return false;
+        }
+        return v.value(
+            string_t{}, idx,
+            std::string_view(reinterpret_cast<const char*>(in.data() + 32),
+                             len));
+    }
+};
+
+namespace visit_detail {
+
+// A walk returns false both on malformed input and when the visitor stops
+// it; only the former has set *e (visit() starts from a clean Error), so
+// containers add their index and base offset only then
+inline void nest(Error* e, size_t i, size_t base) {
+    if (e && e->code != ErrorCode::none) e->nest(uint32_t(i), base);
+}
+
+template <class T>
+inline constexpr size_t stride =
+    traits<T>::is_dynamic ? 32 : 32 * traits<T>::head_words;
+
+// The head area at the start of in holds n elements. Checked before
+// begin_array, so visitors only ever see lengths the input can back.
+template <class T>
+inline bool heads_fit(BytesSpan in, size_t n, Error* e,
+                      const char* short_msg) {
+    if (n > in.size() / stride<T>) {
+        if (e) e->set_static(ErrorCode::short_input, short_msg);
+        return false;
+    }
+    return true;
+}
+
+// Walk n elements laid out as a head area at the start of in (static
+// elements inline, dynamic elements as offsets relative to in); the caller
+// has checked heads_fit. base is where in starts within the array's own
+// encoding, so error offsets match traits<>::decode.
+template <class T, class V>
+inline bool walk_elems(BytesSpan in, size_t base, size_t n, V& v, Error* e,
+                       const char* off_msg) {
+    constexpr size_t stride = visit_detail::stride<T>;
+    for (size_t i = 0; i < n; ++i) {
+        const uint8_t* h = in.data() + i * stride;
+        if constexpr (traits<T>::is_dynamic) {
+            size_t off = 0;
+            if (!read_size_word(h, off) || off > in.size()) {
+                if (e)
+                    e->set_static(ErrorCode::bad_offset, off_msg,
+                                  base + i * stride);
+                return false;
+            }
+            if (!visit_traits<T>::walk(
+                    BytesSpan(in.data() + off, in.size() - off), i, v, e)) {
+                nest(e, i, base + off);
+                return false;
+            }
+        } else {
+            if (!visit_traits<T>::walk(BytesSpan(h, stride), i, v, e)) {
+                nest(e, i, base + i * stride);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace visit_detail
+
+template <class T, size_t N>
+struct visit_traits<static_array<T, N>> {
+    template <class V>
+    static bool walk(BytesSpan in, size_t idx, V& v, Error* e) {
+        if (!visit_detail::heads_fit<T>(in, N, e, "static_array: short") ||
+            !v.begin_array(idx, N) ||
+            !visit_detail::walk_elems<T>(in, 0, N, v, e,
+                                         "static_array: bad off"))
+            return false;
+        return v.end_array();
+    }
+};
+
+template <class T>
+struct visit_traits<dyn_array<T>> {
+    template <class V>
+    static bool walk(BytesSpan in, size_t idx, V& v, Error* e) {
+        size_t len = 0;
+        if (in.size() < 32 || !read_size_word(in.data(), len)) {
+            if (e) e->set(ErrorCode::short_input, "dyn_array: short");
+            return false;
+        }
+        const BytesSpan heads(in.data() + 32, in.size() - 32);
+        const char* short_msg = traits<T>::is_dynamic
+                                    ? "dyn_array: offs short"
+                                    : "dyn_array: inline short";
+        if (!visit_detail::heads_fit<T>(heads, len, e, short_msg) ||
+            !v.begin_array(idx, len) ||
+            !visit_detail::walk_elems<T>(heads, 32, len, v, e,
+                                         "dyn_array: bad off"))
+            return false;
+        return v.end_array();
+    }
+};
+
+template <class... Ts>
+struct visit_traits<tuple<Ts...>> {
+    template <class V>
+    static bool walk(BytesSpan in, size_t idx, V& v, Error* e) {
+        constexpr size_t need = 32 * traits<tuple<Ts...>>::head_words_static;
+        if (in.size() < need) {
+            if (e) e->set(ErrorCode::short_input, "tuple: head short");
+            return false;
+        }
+        if (!v.begin_tuple(idx)) return false;
+        bool ok = true;
+        size_t head = 0;
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((ok = ok && field<Ts>(in, head, I, v, e)), ...);
+        }(std::index_sequence_for<Ts...>{});
+        return ok && v.end_tuple();
+    }
+
+private:
+    template <class T, class V>
+    static bool field(BytesSpan in, size_t& head, size_t i, V& v, Error* e) {
+        if constexpr (traits<T>::is_dynamic) {
+            size_t off = 0;
+            if (!read_size_word(in.data() + head, off) || off > in.size()) {
+                if (e) e->set(ErrorCode::bad_offset, "tuple: bad off", head);
+                return false;
+            }
+            head += 32;
+            if (!visit_traits<T>::walk(
+                    BytesSpan(in.data() + off, in.size() - off), i, v, e)) {
+                visit_detail::nest(e, i, off);
+                return false;
+            }
+        } else {
+            const size_t n = 32 * traits<T>::head_words;
+            const BytesSpan s(in.data() + head, n);
+            if (!visit_traits<T>::walk(s, i, v, e)) {
+                visit_detail::nest(e, i, head);
+                return false;
+            }
+            head += n;
+        }
+        return true;
+    }
+};
+
+// Named structs walk their underlying tuple schema
+template <class Schema>
+struct visit_traits {
+    template <class V>
+    static bool walk(BytesSpan in, size_t idx, V& v, Error* e) {
+        return visit_traits<typename Schema::schema>::walk(in, idx, v, e);
+    }
+};
+
+// Walk a payload laid out like decode_from<Schema> expects. Returns false on
+// malformed input (e filled in as by decode_from: code, message, path and
+// absolute offset) or when the visitor stopped the walk (e left untouched).
+template <class Schema, class V>
+inline bool visit(BytesSpan in, V& visitor, Error* e = nullptr) {
+    Error err;
+    Error* const pe = e ? &err : nullptr;
+    size_t off = 0;
+    if constexpr (needs_top_ptr<Schema>::value) {
+        if (in.size() < 32 || !read_size_word(in.data(), off)) {
+            if (e) e->set(ErrorCode::short_input, "top: short");
+            return false;
+        }
+        if (off > in.size()) {
+            if (e) e->set(ErrorCode::bad_offset, "top: bad off");
+            return false;
+        }
+    }
+    if (visit_traits<Schema>::walk(
+            BytesSpan(in.data() + off, in.size() - off), 0, visitor, pe))
+        return true;
+    if (e && err.code != ErrorCode::none) {
+        err.shift(off);
+        *e = std::move(err);
+    }
+    return false;
+}
+
+}  // namespace abi
@@ -322,6 +322,8 @@ function generateNamedSchemas() {
     // Values tuple type (concrete C++ value types)
     const valuesTypes = schemaTypes.map(t => fieldValueCppType(t));
     output += `  using values = std::tuple<${valuesTypes.join(', ')}>;\n`;
+    const memberNames = structInfo.fields.map((field, index) => toCamelCase(field.name || `f${index}`));
+    output += `  static constexpr std::array<const char*, ${memberNames.length}> field_names{{${memberNames.map(n => `"${n}"`).join(', ')}}};\n`;
 
     // to_tuple conversion
     output += `\n  // Conversion to underlying tuple values\n`;
@@ -335,6 +337,15 @@ function generateNamedSchemas() {
     output += `    );\n`;
     output += `  }\n`;
 
+    // Borrowed field references (no copies), used by abi/json.h
+    output += `\n  // Borrowed references to the fields, in schema order\n`;
+    output += `  static auto tie(const ${structName}& s) {\n`;
+    output += `    return std::tie(${memberNames.map(n => `s.${n}`).join(', ')});\n`;
+    output += `  }\n`;
+    output += `  static auto tie(${structName}& s) {\n`;
+    output += `    return std::tie(${memberNames.map(n => `s.${n}`).join(', ')});\n`;
+    output += `  }\n`;
+
     // from_tuple conversion
     output += `\n  // Conversion from underlying tuple values\n`;
     output += `  static ${structName} from_tuple(const values& t) {\n`;
@@ -393,6 +404,80 @@ function generateNamedSchemas() {
   return output;
 }
 
+// Named structs with a member that allocates (bytes, string, an array, or a
+// named struct that does). namedStructs lists dependencies first.
+function allocatingStructNames() {
+  const names = new Set();
+  for (const [fullName, structInfo] of namedStructs) {
+    const allocates = structInfo.fields.some(field => {
+      const t = cppTypeForParam(field);
+      return /\b(bytes|string_t|dyn_array)\b/.test(t) ||
+        Array.from(names).some(n => new RegExp(`\\b${n}\\b`).test(t));
+    });
+    if (allocates) names.add(`${structInfo.contract}_${structInfo.name}`);
+  }
+  return names;
+}
+
+// Allocator-aware twins in abi::protocols::pmr: the same fields with
+// pmr_value_t member types, plus the uses-allocator constructors that let a
+// std::pmr container hand its resource down to them.
+function generatePmrNamedSchemas(pmrStructs) {
+  let output = '';
+
+  // Inside protocols::pmr a bare struct name would mean the twin
+  const namedStructTypeNames = new Set(
+    Array.from(namedStructs.values()).map(s => `${s.contract}_${s.name}`)
+  );
+  const qualify = t => t.replace(/\b[A-Za-z0-9_]+\b/g,
+    w => namedStructTypeNames.has(w) ? `protocols::${w}` : w);
+
+  for (const [fullName, structInfo] of namedStructs) {
+    const structName = `${structInfo.contract}_${structInfo.name}`;
+    if (!pmrStructs.has(structName)) continue;
+    const schemaTypes = structInfo.fields.map(field => qualify(cppTypeForParam(field)));
+    const memberNames = structInfo.fields.map((field, index) => toCamelCase(field.name || `f${index}`));
+    const init = arg => memberNames.map(n =>
+      `${n}(abi::detail::make_with_allocator<decltype(${n})>(a${arg(n)}))`).join(',\n      ');
+
+    output += `// ---------- Allocator-aware ${fullName} ----------\n`;
+    output += `struct ${structName} {\n`;
+    output += `  using allocator_type = std::pmr::polymorphic_allocator<std::byte>;\n\n`;
+    memberNames.forEach((n, i) => {
+      output += `  abi::pmr_value_t<${schemaTypes[i]}> ${n}{};\n`;
+    });
+
+    output += `\n  // Underlying ABI schema\n`;
+    output += `  using schema = abi::tuple<${schemaTypes.join(', ')}>;\n`;
+    output += `  static constexpr std::array<const char*, ${memberNames.length}> field_names{{${memberNames.map(n => `"${n}"`).join(', ')}}};\n`;
+
+    output += `\n  // Members that allocate use a, including when copied or moved into a\n`;
+    output += `  // std::pmr container\n`;
+    output += `  ${structName}() = default;\n`;
+    output += `  explicit ${structName}(const allocator_type& a)\n`;
+    output += `    : ${init(n => '')} {}\n`;
+    output += `  ${structName}(const ${structName}& o, const allocator_type& a)\n`;
+    output += `    : ${init(n => `, o.${n}`)} {}\n`;
+    output += `  ${structName}(${structName}&& o, const allocator_type& a)\n`;
+    output += `    : ${init(n => `, std::move(o.${n})`)} {}\n`;
+    output += `  ${structName}(const ${structName}&) = default;\n`;
+    output += `  ${structName}(${structName}&&) = default;\n`;
+    output += `  ${structName}& operator=(const ${structName}&) = default;\n`;
+    output += `  ${structName}& operator=(${structName}&&) = default;\n`;
+
+    output += `\n  // Borrowed references to the fields, in schema order\n`;
+    output += `  static auto tie(const ${structName}& s) {\n`;
+    output += `    return std::tie(${memberNames.map(n => `s.${n}`).join(', ')});\n`;
+    output += `  }\n`;
+    output += `  static auto tie(${structName}& s) {\n`;
+    output += `    return std::tie(${memberNames.map(n => `s.${n}`).join(', ')});\n`;
+    output += `  }\n`;
+    output += `};\n\n`;
+  }
+
+  return output;
+}
+
 function generateTraitsSpecializations() {
   let traits = '';
 
@@ -402,13 +487,28 @@ function generateTraitsSpecializations() {
   }
 
   // Generate value_of specializations first
-  traits += `// value_of specializations for named structs\n`;
+  traits += `// value_of specializations for named structs (the struct itself, whatever the containers)\n`;
   for (const [fullName, structInfo] of namedStructs) {
     const structName = `protocols::${structInfo.contract}_${structInfo.name}`;
-    traits += `template<> struct value_of<${structName}> { using type = ${structName}; };\n`;
+    traits += `template<class C> struct value_of<${structName}, C> { using type = ${structName}; };\n`;
   }
   traits += `\n`;
 
+  // pmr_containers maps structs whose members allocate to their twins, so a
+  // pmr_value_t tree stays in one memory_resource all the way down
+  const pmrStructs = allocatingStructNames();
+  traits += `namespace protocols {\nnamespace pmr {\n`;
+  for (const name of pmrStructs) traits += `struct ${name};\n`;
+  traits += `} // namespace pmr\n} // namespace protocols\n\n`;
+  traits += `// value_of specializations for pmr_containers (the allocator-aware twin)\n`;
+  for (const name of pmrStructs) {
+    traits += `template<> struct value_of<protocols::${name}, pmr_containers> { using type = protocols::pmr::${name}; };\n`;
+  }
+  traits += `\n`;
+  traits += `namespace protocols {\nnamespace pmr {\n\n`;
+  traits += generatePmrNamedSchemas(pmrStructs);
+  traits += `} // namespace pmr\n} // namespace protocols\n\n`;
+
   // Generate traits specializations that delegate to underlying tuple schema
   traits += `// traits specializations that delegate to underlying tuple schema\n`;
   for (const [fullName, structInfo] of namedStructs) {
@@ -431,13 +531,44 @@ function generateTraitsSpecializations() {
     traits += `    traits<S>::encode_tail(out, base, ${structName}::to_tuple(v));\n`;
     traits += `  }\n\n`;
 
+    traits += `  // Tuple-like values (e.g. std::tuple of references) encode without a copy\n`;
+    traits += `  template <class V>\n`;
+    traits += `  static size_t tail_size(const V& v) { return traits<S>::tail_size(v); }\n`;
+    traits += `  template <class V>\n`;
+    traits += `  static void encode_head(uint8_t* out32, size_t hi, const V& v, size_t base) {\n`;
+    traits += `    traits<S>::encode_head(out32, hi, v, base);\n`;
+    traits += `  }\n`;
+    traits += `  template <class V>\n`;
+    traits += `  static void encode_tail(uint8_t* out, size_t base, const V& v) {\n`;
+    traits += `    traits<S>::encode_tail(out, base, v);\n`;
+    traits += `  }\n\n`;
+
+    traits += `  // Decodes straight into the fields, reusing their storage\n`;
+    traits += `  template <class P = checked>\n`;
     traits += `  static bool decode(BytesSpan in, ${structName}& out, Error* e=nullptr) {\n`;
-    traits += `    abi::value_of<S>::type tmp;\n`;
-    traits += `    if (!traits<S>::decode(in, tmp, e)) return false;\n`;
-    traits += `    out = ${structName}::from_tuple(tmp);\n`;
-    traits += `    return true;\n`;
+    traits += `    auto fields = ${structName}::tie(out);\n`;
+    traits += `    return traits<S>::template decode<P>(in, fields, e);\n`;
     traits += `  }\n`;
 
+    if (pmrStructs.has(`${structInfo.contract}_${structInfo.name}`)) {
+      const pmrName = `protocols::pmr::${structInfo.contract}_${structInfo.name}`;
+      traits += `\n  // The allocator-aware twin encodes and decodes through its fields\n`;
+      traits += `  static size_t tail_size(const ${pmrName}& v) {\n`;
+      traits += `    return traits<S>::tail_size(${pmrName}::tie(v));\n`;
+      traits += `  }\n`;
+      traits += `  static void encode_head(uint8_t* out32, size_t hi, const ${pmrName}& v, size_t base) {\n`;
+      traits += `    traits<S>::encode_head(out32, hi, ${pmrName}::tie(v), base);\n`;
+      traits += `  }\n`;
+      traits += `  static void encode_tail(uint8_t* out, size_t base, const ${pmrName}& v) {\n`;
+      traits += `    traits<S>::encode_tail(out, base, ${pmrName}::tie(v));\n`;
+      traits += `  }\n`;
+      traits += `  template <class P = checked>\n`;
+      traits += `  static bool decode(BytesSpan in, ${pmrName}& out, Error* e=nullptr) {\n`;
+      traits += `    auto fields = ${pmrName}::tie(out);\n`;
+      traits += `    return traits<S>::template decode<P>(in, fields, e);\n`;
+      traits += `  }\n`;
+    }
+
     traits += `};\n\n`;
   }
 
@@ -526,6 +657,7 @@ namespace protocols {
   }
 
   // Second pass: process each ABI file for function generation
+  const functionIndex = [];
   for (const [contractName, abiPath] of Object.entries(abiFiles)) {
     try {
       const abiContent = fs.readFileSync(abiPath, 'utf8');
@@ -605,6 +737,7 @@ namespace protocols {
             const returnType = synthesizedReturnType || cppType.returnType;
             const args = [returnType, ...cppType.inputTypes].join(', ');
             header += `using ${functionName} = Fn<${selectorName}, ${args}>;\n`;
+            functionIndex.push({ selectorName, functionName, signature });
           }
 
           header += '\n';
@@ -647,6 +780,21 @@ namespace protocols {
     }
   }
 
+  // Function index: selector table plus a type list of every Fn alias
+  header += `// ==============================\n`;
+  header += `// Function index\n`;
+  header += `// ==============================\n\n`;
+  header += `// Every generated function, for selector-driven dispatch (abi/registry.h)\n`;
+  header += `struct FunctionInfo { std::array<uint8_t,4> selector; const char* name; const char* signature; };\n`;
+  header += `inline constexpr FunctionInfo all_functions[] = {\n`;
+  for (const f of functionIndex) {
+    header += `    {${f.selectorName}::value, "${f.functionName}", "${f.signature}"},\n`;
+  }
+  header += `};\n`;
+  header += `using AllFunctions = std::tuple<\n`;
+  header += functionIndex.map(f => `    ${f.functionName}`).join(',\n');
+  header += `>;\n\n`;
+
   header += `} // namespace protocols\n`;
   header += `} // namespace abi\n`;
 
@@ -3,8 +3,10 @@
 #include <cstdint>
 #include <cstdio>
 #include <exception>
+#include <forward_list>
 #include <iostream>
 #include <memory>
+#include <memory_resource>
 #include <numeric>
 #include <stdexcept>
 #include <string>
@@ -20,6 +22,15 @@
 // Type aliases for convenience
 using uint256_t = boost::multiprecision::cpp_int;
 #include "abi/protocols.h"
+#include "abi/multicall.h"
+#include "abi/visit.h"
+#include "abi/uniswap_v3.h"
+#include "abi/dyn.h"
+#include "abi/registry.h"
+#include "abi/json.h"
+#include "abi/hex.h"
+#include "abi/u256.h"
+#include "abi/canonical.h"
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Small, focused utilities
@@ -1289,6 +1300,2214 @@ int main() try {
         return true;  // If we get here without compilation errors, test passes
       })());
   }
+
+  // ─────────────────────────────────────────────────────────────────────────────
+  // Multicall helpers (abi/multicall.h)
+  // ─────────────────────────────────────────────────────────────────────────────
+  std::cout << "\n== multicall helpers ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    using abi::protocols::Multicall3_Result;
+
+    // Build an aggregate3 response: [balanceOf -> 1000, failed call, token0 -> addr]
+    auto make_aggregate3_response = [](){
+      std::vector<Multicall3_Result> results(3);
+      results[0].success = true;
+      results[0].returnData.resize(32);
+      abi::write_u256_imm(results[0].returnData.data(), 1000);
+      results[1].success = false;
+      results[1].returnData = {0x08, 0xc3, 0x79, 0xa0, 0x01};
+      results[2].success = true;
+      results[2].returnData.assign(32, 0);
+      std::fill(results[2].returnData.begin() + 12, results[2].returnData.end(), 0x22);
+      std::vector<uint8_t> buf(abi::encoded_size<abi::dyn_array<Multicall3_Result>>(results));
+      abi::encode_into<abi::dyn_array<Multicall3_Result>>(buf.data(), buf.size(), results);
+      return buf;
+    };
+
+    RUN_TEST("ResultsView matches Aggregate3::decode_result",
+      ([&](){
+        auto buf = make_aggregate3_response();
+        abi::BytesSpan in(buf.data(), buf.size());
+        std::vector<Multicall3_Result> owned;
+        if (!Aggregate3::decode_result(in, owned)) return false;
+
+        abi::multicall::ResultsView view;
+        abi::Error err;
+        if (!abi::multicall::ResultsView::parse(in, view, &err)) {
+          std::cerr << "parse failed: " << err.message << "\n";
+          return false;
+        }
+        if (view.size() != owned.size()) return false;
+        size_t i = 0;
+        for (auto r : view) {
+          const auto& o = owned[i++];
+          if (r.success != o.success || r.returnData.size() != o.returnData.size() ||
+              !std::equal(r.returnData.begin(), r.returnData.end(), o.returnData.begin()))
+            return false;
+        }
+        return i == owned.size();
+      })());
+
+    RUN_TEST("ResultsView per-entry typed decode (heterogeneous Fn)",
+      ([&](){
+        auto buf = make_aggregate3_response();
+        abi::multicall::ResultsView view;
+        if (!abi::multicall::ResultsView::parse(abi::BytesSpan(buf.data(), buf.size()), view)) return false;
+        BalanceOf::return_t balance;
+        abi::protocols::UniswapV3Pool_Token0::return_t token0{};
+        if (!view[0].success || !view[0].decode<BalanceOf>(balance)) return false;
+        if (view[1].success) return false;
+        if (!view[2].success || !view[2].decode<abi::protocols::UniswapV3Pool_Token0>(token0)) return false;
+        std::array<uint8_t, 20> expect;
+        expect.fill(0x22);
+        return balance == 1000 && token0 == expect;
+      })());
+
+    RUN_TEST("ResultsView rejects out-of-range returnData length",
+      ([&](){
+        auto buf = make_aggregate3_response();
+        // top(32) + len(32) + 3 offsets(96) -> first element; bytes len at +64
+        abi::write_u256_imm(buf.data() + 32 + 32 + 96 + 64, 0x10000);
+        abi::multicall::ResultsView view;
+        abi::Error err;
+        return !abi::multicall::ResultsView::parse(abi::BytesSpan(buf.data(), buf.size()), view, &err);
+      })());
+
+    const auto pool = abi::addr_from_hex("0x8ad599c3a0ff1de082011efddc58f1908eb6e6d8");
+    const auto holder = abi::addr_from_hex("0x1111111111111111111111111111111111111111");
+    using Token0 = abi::protocols::UniswapV3Pool_Token0;
+    using Token1 = abi::protocols::UniswapV3Pool_Token1;
+
+    RUN_TEST("Multicall<...> aggregate3 encoding matches Multicall3_Call3 path",
+      ([&](){
+        using abi::multicall::call;
+        auto c0 = call<BalanceOf>(pool, holder);
+        auto c1 = call<Token0>(pool);
+        c1.allow_failure = false;
+
+        std::vector<abi::protocols::Multicall3_Call3> legacy(2);
+        legacy[0].target = pool;
+        legacy[0].allowFailure = true;
+        legacy[0].callData.resize(BalanceOf::encoded_size(holder));
+        BalanceOf::encode_call<std::array<uint8_t, 20>>(legacy[0].callData.data(), legacy[0].callData.size(), holder);
+        legacy[1].target = pool;
+        legacy[1].allowFailure = false;
+        legacy[1].callData.resize(Token0::encoded_size());
+        Token0::encode_call<>(legacy[1].callData.data(), legacy[1].callData.size());
+        std::vector<uint8_t> expect(Aggregate3::encoded_size(legacy));
+        Aggregate3::encode_call<std::vector<abi::protocols::Multicall3_Call3>>(expect.data(), expect.size(), legacy);
+
+        using MC = abi::Multicall<BalanceOf, Token0>;
+        std::vector<uint8_t> got(MC::encoded_size_aggregate3(c0, c1));
+        if (!MC::encode_aggregate3(got.data(), got.size(), c0, c1)) return false;
+        return got == expect && !MC::encode_aggregate3(got.data(), got.size() - 1, c0, c1);
+      })());
+
+    RUN_TEST("Multicall<...> tryAggregate encoding matches ethers.js",
+      ([&](){
+        using abi::multicall::call;
+        using MC = abi::Multicall<Token0, Token1>;
+        auto c0 = call<Token0>(pool);
+        auto c1 = call<Token1>(pool);
+        std::vector<uint8_t> got(MC::encoded_size_try_aggregate(c0, c1));
+        if (!MC::encode_try_aggregate(got.data(), got.size(), false, c0, c1)) return false;
+        // Output of scripts/multicall3_rpc_test.mjs (see multicall_perf_comparison.cpp)
+        const std::string expect = "0xbce38bd7000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000400000000000000000000000000000000000000000000000000000000000000002000000000000000000000000000000000000000000000000000000000000004000000000000000000000000000000000000000000000000000000000000000c00000000000000000000000008ad599c3a0ff1de082011efddc58f1908eb6e6d8000000000000000000000000000000000000000000000000000000000000004000000000000000000000000000000000000000000000000000000000000000040dfe1681000000000000000000000000000000000000000000000000000000000000000000000000000000008ad599c3a0ff1de082011efddc58f1908eb6e6d800000000000000000000000000000000000000000000000000000000000000400000000000000000000000000000000000000000000000000000000000000004d21220a700000000000000000000000000000000000000000000000000000000";
+        return abi::bytes_to_hex_string(got) == expect;
+      })());
+
+    RUN_TEST("Multicall<...>::decode typed tuple with per-call success",
+      ([&](){
+        auto buf = make_aggregate3_response();
+        using MC = abi::Multicall<BalanceOf, Token0, Token1>;
+        MC::Results res;
+        abi::Error err;
+        if (!MC::decode(abi::BytesSpan(buf.data(), buf.size()), res, &err)) return false;
+        std::array<uint8_t, 20> expect;
+        expect.fill(0x22);
+        // Wrong arity must be rejected
+        abi::Multicall<BalanceOf>::Results short_res;
+        if (abi::Multicall<BalanceOf>::decode(abi::BytesSpan(buf.data(), buf.size()), short_res, &err))
+          return false;
+        // Token0 slot failed on-chain; Token1 slot carries the address
+        return res.success[0] && !res.success[1] && res.success[2] &&
+               std::get<0>(res.values) == 1000 && std::get<2>(res.values) == expect;
+      })());
+
+    RUN_TEST("MulticallBatch<Fn> runtime batch round-trip",
+      ([&](){
+        using abi::multicall::call;
+        using Batch = abi::MulticallBatch<BalanceOf>;
+        std::vector<decltype(call<BalanceOf>(pool, holder))> calls;
+        for (int i = 0; i < 4; ++i) calls.push_back(call<BalanceOf>(pool, holder));
+        std::vector<uint8_t> enc(Batch::encoded_size_aggregate3(calls));
+        if (!Batch::encode_aggregate3(enc.data(), enc.size(), calls)) return false;
+        std::vector<abi::protocols::Multicall3_Call3> decoded;
+        if (!abi::decode_from<abi::dyn_array<abi::protocols::Multicall3_Call3>>(
+                abi::BytesSpan(enc.data() + 4, enc.size() - 4), decoded))
+          return false;
+        if (decoded.size() != 4 || decoded[3].callData.size() != 36) return false;
+
+        std::vector<Multicall3_Result> results(4);
+        for (size_t i = 0; i < results.size(); ++i) {
+          results[i].success = i != 2;
+          results[i].returnData.resize(32);
+          abi::write_u256_imm(results[i].returnData.data(), 7 * i);
+        }
+        std::vector<uint8_t> resp(abi::encoded_size<abi::dyn_array<Multicall3_Result>>(results));
+        abi::encode_into<abi::dyn_array<Multicall3_Result>>(resp.data(), resp.size(), results);
+        Batch::Results out;
+        if (!Batch::decode(abi::BytesSpan(resp.data(), resp.size()), out)) return false;
+        return out.values.size() == 4 && out.success[0] && !out.success[2] &&
+               out.values[3] == 21;
+      })());
+
+    RUN_TEST("dyn_array encodes from lazy ranges without building Call3 vectors",
+      ([&](){
+        using abi::protocols::Multicall3_Call3;
+        // Caller-owned data: per-pool calldata kept in its own structure
+        struct Order { std::array<uint8_t, 20> pool; std::vector<uint8_t> data; };
+        std::vector<Order> orders(3);
+        for (size_t i = 0; i < orders.size(); ++i) {
+          orders[i].pool.fill(static_cast<uint8_t>(0x10 + i));
+          orders[i].data.assign(4 + 33 * i, static_cast<uint8_t>(i));
+        }
+        // Minimal transform view yielding tuples of references (no copies)
+        struct View {
+          const std::vector<Order>* v;
+          struct It {
+            std::vector<Order>::const_iterator it;
+            auto operator*() const {
+              return std::tuple<const std::array<uint8_t, 20>&, bool, abi::BytesSpan>(
+                  it->pool, true, abi::as_bytes_span(it->data));
+            }
+            It& operator++() { ++it; return *this; }
+            bool operator!=(const It& o) const { return it != o.it; }
+          };
+          It begin() const { return {v->begin()}; }
+          It end() const { return {v->end()}; }
+          size_t size() const { return v->size(); }
+        };
+        std::vector<Multicall3_Call3> legacy(orders.size());
+        for (size_t i = 0; i < orders.size(); ++i)
+          legacy[i] = Multicall3_Call3{orders[i].pool, true, orders[i].data};
+        std::vector<uint8_t> expect(Aggregate3::encoded_size(legacy));
+        Aggregate3::encode_call<std::vector<Multicall3_Call3>>(expect.data(), expect.size(), legacy);
+
+        View view{&orders};
+        std::vector<uint8_t> got(Aggregate3::encoded_size(view));
+        if (!Aggregate3::encode_call<View>(got.data(), got.size(), view)) return false;
+        if (got != expect) return false;
+
+        // Unsized forward range of static elements
+        std::forward_list<cpp_int> fl{1, 2, 3};
+        std::vector<cpp_int> vec{1, 2, 3};
+        using Arr = abi::dyn_array<abi::uint_t<256>>;
+        std::vector<uint8_t> a(abi::encoded_size<Arr>(fl)), b(abi::encoded_size<Arr>(vec));
+        abi::encode_into<Arr>(a.data(), a.size(), fl);
+        abi::encode_into<Arr>(b.data(), b.size(), vec);
+        return a == b;
+      })());
+
+    RUN_TEST("plan_aggregate3 chunks match Aggregate3::encode_call per chunk",
+      ([&](){
+        using abi::protocols::Multicall3_Call3;
+        std::vector<Multicall3_Call3> calls(37);
+        for (size_t i = 0; i < calls.size(); ++i) {
+          calls[i].target = pool;
+          calls[i].allowFailure = (i % 3) != 0;
+          calls[i].callData.assign(4 + (i * 7) % 90, static_cast<uint8_t>(i));
+        }
+        abi::multicall::ChunkLimits lim;
+        lim.max_calldata_bytes = 1500;
+        lim.max_calls = 8;
+        abi::multicall::ChunkPlan plan;
+        if (!abi::multicall::plan_aggregate3(calls, lim, plan)) return false;
+        if (plan.chunks.size() < 2) return false;
+        std::vector<uint8_t> out(plan.total_size);
+        if (!abi::multicall::encode_aggregate3_chunks(out.data(), out.size(), calls, plan)) return false;
+        size_t next = 0;
+        for (size_t i = 0; i < plan.chunks.size(); ++i) {
+          const auto& ch = plan.chunks[i];
+          if (ch.first != next || ch.count == 0 || ch.count > lim.max_calls ||
+              ch.calldata_size > lim.max_calldata_bytes)
+            return false;
+          next += ch.count;
+          abi::Span<Multicall3_Call3> sub(calls.data() + ch.first, ch.count);
+          std::vector<uint8_t> expect(Aggregate3::encoded_size(sub));
+          Aggregate3::encode_call<abi::Span<Multicall3_Call3>>(expect.data(), expect.size(), sub);
+          auto got = plan.payload(out.data(), i);
+          if (expect.size() != ch.calldata_size ||
+              !std::equal(expect.begin(), expect.end(), got.begin()))
+            return false;
+        }
+        return next == calls.size() &&
+               !abi::multicall::encode_aggregate3_chunks(out.data(), out.size() - 1, calls, plan);
+      })());
+
+    RUN_TEST("plan_try_aggregate splits typed calls on return-size budget",
+      ([&](){
+        using abi::multicall::call;
+        std::vector<decltype(call<BalanceOf>(pool, holder))> calls(10, call<BalanceOf>(pool, holder));
+        abi::multicall::ChunkLimits lim;
+        // 64 fixed + 4 * (32 offset + 96 result head + 32 uint256)
+        lim.max_return_bytes = 64 + 4 * 160;
+        abi::multicall::ChunkPlan plan;
+        if (!abi::multicall::plan_try_aggregate(calls, lim, plan)) return false;
+        if (plan.chunks.size() != 3 || plan.chunks[2].count != 2) return false;
+        std::vector<uint8_t> out(plan.total_size);
+        if (!abi::multicall::encode_try_aggregate_chunks(out.data(), out.size(), true, calls, plan))
+          return false;
+        using Batch = abi::MulticallBatch<BalanceOf>;
+        std::vector<uint8_t> expect(Batch::encoded_size_try_aggregate(
+            abi::Span<decltype(calls)::value_type>(calls.data(), 4)));
+        Batch::encode_try_aggregate(expect.data(), expect.size(), true,
+            abi::Span<decltype(calls)::value_type>(calls.data(), 4));
+        auto got = plan.payload(out.data(), 1);
+        if (got.size() != expect.size() || !std::equal(expect.begin(), expect.end(), got.begin()))
+          return false;
+        // A single call larger than the calldata budget cannot be planned
+        lim.max_calldata_bytes = 100;
+        abi::Error err;
+        return !abi::multicall::plan_try_aggregate(calls, lim, plan, &err) &&
+               err.message == "multicall: call exceeds chunk limits";
+      })());
+  }
+
+  // ────────────────────────────────────────────────────────────────────────────
+  //  Streaming visitor (abi/visit.h)
+  // ────────────────────────────────────────────────────────────────────────────
+  std::cout << "\n== streaming visitor ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    using abi::protocols::ITickLens_PopulatedTick;
+    using TickArray = abi::dyn_array<ITickLens_PopulatedTick>;
+
+    auto make_ticks = [](size_t n) {
+      std::vector<ITickLens_PopulatedTick> ticks(n);
+      for (size_t i = 0; i < n; ++i) {
+        ticks[i].tick = cpp_int(static_cast<int>(i) * 60 - 887220);
+        ticks[i].liquidityNet = (i % 2) ? -cpp_int(1000003) * (i + 1) : cpp_int(1000003) * (i + 1);
+        ticks[i].liquidityGross = cpp_int(1000003) * (i + 1);
+      }
+      std::vector<uint8_t> buf(abi::encoded_size<TickArray>(ticks));
+      abi::encode_into<TickArray>(buf.data(), buf.size(), ticks);
+      return std::make_pair(ticks, buf);
+    };
+
+    // Folds ticks into caller-owned columns without building the vector
+    struct TickColumns : abi::Visitor {
+      using abi::Visitor::value;
+      std::vector<int32_t> tick;
+      std::vector<int64_t> net;
+      std::vector<uint64_t> gross;
+      size_t limit = SIZE_MAX;
+      bool begin_tuple(size_t i) { return i < limit; }
+      bool value(abi::int_t<24>, size_t, abi::Word w) { tick.push_back(static_cast<int32_t>(w.i64())); return true; }
+      bool value(abi::int_t<128>, size_t, abi::Word w) { net.push_back(w.i64()); return true; }
+      bool value(abi::uint_t<128>, size_t, abi::Word w) { gross.push_back(w.u64()); return true; }
+    };
+
+    RUN_TEST("visit<dyn_array<PopulatedTick>> matches decode_result",
+      ([&](){
+        auto [ticks, buf] = make_ticks(40);
+        std::vector<ITickLens_PopulatedTick> decoded;
+        abi::BytesSpan in(buf.data(), buf.size());
+        if (!GetPopulatedTicksInWord::decode_result(in, decoded)) return false;
+        TickColumns cols;
+        abi::Error err;
+        if (!abi::visit<TickArray>(in, cols, &err)) {
+          std::cerr << "visit failed: " << err.message << "\n";
+          return false;
+        }
+        if (cols.tick.size() != decoded.size()) return false;
+        for (size_t i = 0; i < decoded.size(); ++i) {
+          if (cpp_int(cols.tick[i]) != decoded[i].tick || cpp_int(cols.net[i]) != decoded[i].liquidityNet ||
+              cpp_int(cols.gross[i]) != decoded[i].liquidityGross)
+            return false;
+        }
+        return true;
+      })());
+
+    RUN_TEST("visit stops early and rejects oversized lengths without allocating",
+      ([&](){
+        auto [ticks, buf] = make_ticks(8);
+        TickColumns cols;
+        cols.limit = 3;
+        abi::Error err;
+        if (abi::visit<TickArray>(abi::BytesSpan(buf.data(), buf.size()), cols, &err)) return false;
+        if (!err.message.empty() || cols.tick.size() != 3) return false;
+        // Claim 2^40 elements: must fail on the bounds check, not on resize
+        abi::write_u256_imm(buf.data() + 32, uint64_t(1) << 40);
+        TickColumns all;
+        return !abi::visit<TickArray>(abi::BytesSpan(buf.data(), buf.size()), all, &err) &&
+               err.message == "dyn_array: inline short" && all.tick.empty();
+      })());
+
+    RUN_TEST("visit checks array lengths before begin_array",
+      ([&](){
+        struct Reserve : abi::Visitor {
+          size_t max_n = 0;
+          bool begin_array(size_t, size_t n) { max_n = std::max(max_n, n); return true; }
+        };
+        auto [ticks, buf] = make_ticks(8);
+        abi::write_u256_imm(buf.data() + 32, uint64_t(1) << 40);
+        Reserve r;
+        abi::Error err;
+        if (abi::visit<TickArray>(abi::BytesSpan(buf.data(), buf.size()), r, &err) || r.max_n != 0) return false;
+        // Nested: outer length fine, inner bytes[] length hostile
+        using Nested = abi::dyn_array<abi::dyn_array<abi::bytes>>;
+        std::vector<std::vector<std::vector<uint8_t>>> v{{{1}, {2}}};
+        std::vector<uint8_t> nb(abi::encoded_size<Nested>(v));
+        abi::encode_into<Nested>(nb.data(), nb.size(), v);
+        size_t inner = 0;
+        abi::read_size_word(nb.data() + 64, inner);
+        inner += 64;
+        abi::write_u256_imm(nb.data() + inner, uint64_t(1) << 40);
+        Reserve r2;
+        return !abi::visit<Nested>(abi::BytesSpan(nb.data(), nb.size()), r2, &err) && r2.max_n == 1 &&
+               err.message == "dyn_array: offs short";
+      })());
+
+    RUN_TEST("visit borrows strings, bytes and addresses in nested tuples",
+      ([&](){
+        using S = abi::tuple<abi::string_t, abi::dyn_array<abi::bytes>, abi::address20, abi::bool_t>;
+        abi::cpp_t<S> v;
+        std::get<0>(v) = "streaming";
+        std::get<1>(v) = {{1, 2, 3}, {}, std::vector<uint8_t>(40, 0xab)};
+        std::get<2>(v).fill(0x5a);
+        std::get<3>(v) = true;
+        std::vector<uint8_t> buf(abi::encoded_size<S>(v));
+        abi::encode_into<S>(buf.data(), buf.size(), v);
+
+        struct Collect : abi::Visitor {
+          using abi::Visitor::value;
+          std::string text;
+          std::vector<size_t> lens;
+          size_t array_n = 0, tuples = 0;
+          bool flag = false;
+          std::array<uint8_t, 20> addr{};
+          bool begin_tuple(size_t) { ++tuples; return true; }
+          bool begin_array(size_t, size_t n) { array_n = n; return true; }
+          bool value(abi::string_t, size_t, std::string_view s) { text = std::string(s); return true; }
+          bool value(abi::bytes, size_t, abi::BytesSpan b) { lens.push_back(b.size()); return true; }
+          bool value(abi::address20, size_t, abi::BytesSpan a) { std::copy(a.begin(), a.end(), addr.begin()); return true; }
+          bool value(abi::bool_t, size_t idx, bool b) { flag = b && idx == 3; return true; }
+        } c;
+        if (!abi::visit<S>(abi::BytesSpan(buf.data(), buf.size()), c)) return false;
+        return c.text == "streaming" && c.array_n == 3 && c.lens == std::vector<size_t>{3, 0, 40} &&
+               c.addr == std::get<2>(v) && c.flag && c.tuples == 1;
+      })());
+  }
+
+  // ────────────────────────────────────────────────────────────────────────────
+  //  Uniswap V3 native decoders (abi/uniswap_v3.h)
+  // ────────────────────────────────────────────────────────────────────────────
+  std::cout << "\n== uniswap v3 native decoders ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    using abi::protocols::ITickLens_PopulatedTick;
+    using TickArray = abi::dyn_array<ITickLens_PopulatedTick>;
+
+    auto encode_ticks = [](const std::vector<ITickLens_PopulatedTick>& ticks) {
+      std::vector<uint8_t> buf(abi::encoded_size<TickArray>(ticks));
+      abi::encode_into<TickArray>(buf.data(), buf.size(), ticks);
+      return buf;
+    };
+    auto to_cpp = [](auto v) {
+      // __int128 -> cpp_int via two 64-bit halves
+      bool neg = v < 0;
+      unsigned __int128 u = neg ? (unsigned __int128)0 - (unsigned __int128)v : (unsigned __int128)v;
+      cpp_int r = (cpp_int(uint64_t(u >> 64)) << 64) | cpp_int(uint64_t(u));
+      return neg ? cpp_int(-r) : r;
+    };
+
+    RUN_TEST("TickLens columnar decode matches decode_result (incl. extremes)",
+      ([&](){
+        std::vector<ITickLens_PopulatedTick> ticks(5);
+        const cpp_int two127 = cpp_int(1) << 127;
+        const cpp_int net[] = {0, -1, two127 - 1, -two127, 123456789};
+        const cpp_int gross[] = {0, 1, (cpp_int(1) << 128) - 1, two127, 987654321};
+        const int tick[] = {-887272, 887272, 0, -1, 60};
+        for (size_t i = 0; i < ticks.size(); ++i)
+          ticks[i] = ITickLens_PopulatedTick{tick[i], net[i], gross[i]};
+        auto buf = encode_ticks(ticks);
+        std::vector<ITickLens_PopulatedTick> ref;
+        abi::BytesSpan in(buf.data(), buf.size());
+        if (!GetPopulatedTicksInWord::decode_result(in, ref)) return false;
+        abi::uniswap_v3::TickColumns cols;
+        abi::Error err;
+        // Two words appended into the same columns
+        if (!abi::uniswap_v3::decode_populated_ticks(in, cols, &err) ||
+            !abi::uniswap_v3::decode_populated_ticks(in, cols, &err)) {
+          std::cerr << "columnar decode failed: " << err.message << "\n";
+          return false;
+        }
+        if (cols.size() != 2 * ref.size()) return false;
+        for (size_t i = 0; i < cols.size(); ++i) {
+          const auto& r = ref[i % ref.size()];
+          if (cpp_int(cols.tick[i]) != r.tick || to_cpp(cols.liquidityNet[i]) != r.liquidityNet ||
+              to_cpp(cols.liquidityGross[i]) != r.liquidityGross)
+            return false;
+        }
+        return true;
+      })());
+
+    using abi::protocols::IUniswapV3Pool_Slot0;
+    using Slot0Fn = abi::protocols::UniswapV3Pool_Slot0;
+    auto encode_slot0 = [](const IUniswapV3Pool_Slot0& s) {
+      std::vector<uint8_t> buf(abi::encoded_size<IUniswapV3Pool_Slot0>(s));
+      abi::encode_into<IUniswapV3Pool_Slot0>(buf.data(), buf.size(), s);
+      return buf;
+    };
+    const IUniswapV3Pool_Slot0 slot0_ref{
+        cpp_int("1461446703485210103287273052203988822378723970341"),  // TickMath.MAX_SQRT_RATIO - 1
+        -201234, 17, 720, 721, 0x44, true};
+
+    RUN_TEST("Slot0 POD decode matches generic decode_result",
+      ([&](){
+        auto buf = encode_slot0(slot0_ref);
+        IUniswapV3Pool_Slot0 ref;
+        abi::BytesSpan in(buf.data(), buf.size());
+        if (!Slot0Fn::decode_result(in, ref)) return false;
+        abi::uniswap_v3::Slot0 pod{};
+        if (!abi::uniswap_v3::decode_slot0(in, pod)) return false;
+        // u256 round-trips through big-endian bytes
+        uint8_t be[32];
+        pod.sqrtPriceX96.to_be(be);
+        return pod.sqrtPriceX96.to_cpp_int() == ref.sqrtPriceX96 && std::equal(be, be + 32, buf.begin()) &&
+               cpp_int(pod.tick) == ref.tick && cpp_int(pod.observationIndex) == ref.observationIndex &&
+               cpp_int(pod.observationCardinality) == ref.observationCardinality &&
+               cpp_int(pod.observationCardinalityNext) == ref.observationCardinalityNext &&
+               cpp_int(pod.feeProtocol) == ref.feeProtocol && pod.unlocked == ref.unlocked;
+      })());
+
+    RUN_TEST("Slot0 batch decode over aggregate3 results",
+      ([&](){
+        using abi::protocols::Multicall3_Result;
+        std::vector<Multicall3_Result> results(3);
+        results[0] = Multicall3_Result{true, encode_slot0(slot0_ref)};
+        results[1] = Multicall3_Result{false, {}};
+        results[2] = Multicall3_Result{true, encode_slot0(slot0_ref)};
+        results[2].returnData[64 + 29] = 0x01;  // observationIndex beyond uint16
+        std::vector<uint8_t> resp(abi::encoded_size<abi::dyn_array<Multicall3_Result>>(results));
+        abi::encode_into<abi::dyn_array<Multicall3_Result>>(resp.data(), resp.size(), results);
+        std::vector<abi::uniswap_v3::Slot0> pods;
+        std::vector<bool> ok;
+        if (!abi::uniswap_v3::decode_slot0_batch(abi::BytesSpan(resp.data(), resp.size()), pods, ok))
+          return false;
+        return pods.size() == 3 && ok[0] && !ok[1] && !ok[2] && pods[0].tick == -201234 &&
+               pods[0].observationCardinalityNext == 721 && pods[0].feeProtocol == 0x44;
+      })());
+
+    RUN_TEST("liquidity() native decode",
+      ([&](){
+        std::vector<uint8_t> w(32, 0);
+        std::fill(w.begin() + 16, w.end(), 0xff);
+        abi::uniswap_v3::uint128 liq = 0;
+        if (!abi::uniswap_v3::decode_liquidity(abi::BytesSpan(w.data(), w.size()), liq) || liq != ~(abi::uniswap_v3::uint128)0)
+          return false;
+        w[15] = 1;
+        return !abi::uniswap_v3::decode_liquidity(abi::BytesSpan(w.data(), w.size()), liq);
+      })());
+
+    RUN_TEST("TickLens columnar decode rejects out-of-range and short input",
+      ([&](){
+        std::vector<ITickLens_PopulatedTick> ticks(2);
+        ticks[0] = ITickLens_PopulatedTick{-5, -5, 5};
+        ticks[1] = ITickLens_PopulatedTick{7, 7, 7};
+        auto buf = encode_ticks(ticks);
+        abi::uniswap_v3::TickColumns cols;
+        abi::Error err;
+        // tick word of element 1 with a value beyond int24
+        auto bad = buf;
+        bad[64 + 96 + 28] = 0x01;
+        if (abi::uniswap_v3::decode_populated_ticks(abi::BytesSpan(bad.data(), bad.size()), cols, &err) ||
+            err.message != "ticks: value out of range" || cols.size() != 0)
+          return false;
+        // liquidityGross with bit 128 set
+        bad = buf;
+        bad[64 + 64 + 15] = 0x01;
+        if (abi::uniswap_v3::decode_populated_ticks(abi::BytesSpan(bad.data(), bad.size()), cols, &err))
+          return false;
+        return !abi::uniswap_v3::decode_populated_ticks(abi::BytesSpan(buf.data(), buf.size() - 1), cols, &err) &&
+               cols.size() == 0;
+      })());
+
+    RUN_TEST("Swap columns and sqrtPriceX96 price kernels",
+      ([&](){
+        using abi::protocols::UniswapV3Pool_SwapEventData;
+        abi::uniswap_v3::SwapColumns cols;
+        const cpp_int q96 = cpp_int(1) << 96;
+        std::vector<cpp_int> sqrtp{q96, q96 * 2, q96 / 3, slot0_ref.sqrtPriceX96, cpp_int("4295128740"),
+                                   cpp_int("1771595571142957166518320255467520"), q96 * 5 / 7};
+        for (size_t i = 0; i < sqrtp.size(); ++i) {
+          UniswapV3Pool_SwapEventData ev{-cpp_int(1000) * (i + 1), (cpp_int(1) << 200) + i, sqrtp[i],
+                                         (cpp_int(1) << 127) + i, -887272 + int(i)};
+          std::vector<uint8_t> buf(abi::encoded_size<UniswapV3Pool_SwapEventData>(ev));
+          abi::encode_into<UniswapV3Pool_SwapEventData>(buf.data(), buf.size(), ev);
+          abi::Error err;
+          if (!abi::uniswap_v3::decode_swap(abi::BytesSpan(buf.data(), buf.size()), cols, &err)) return false;
+          if (abi::sign_extend<256>(cols.amount0[i].to_cpp_int()) != ev.amount0 ||
+              abi::i256_to_double(cols.amount0[i]) != -1000.0 * (i + 1) ||
+              cols.sqrtPriceX96[i].to_cpp_int() != sqrtp[i] || to_cpp(cols.liquidity[i]) != ev.liquidity ||
+              cols.tick[i] != -887272 + int(i))
+            return false;
+        }
+        std::vector<double> price(cols.size());
+        abi::uniswap_v3::sqrt_price_x96_to_price(cols, price.data(), 1e12);
+        if (price[0] != 1e12 || price[1] != 4e12) return false;
+        for (size_t i = 0; i < cols.size(); ++i) {
+          // Reference from the exact square, rounded once
+          const cpp_int sq = sqrtp[i] * sqrtp[i];
+          const double ref = std::ldexp(sq.convert_to<double>(), -192) * 1e12;
+          if (std::abs(price[i] - ref) > 4e-16 * ref) return false;
+          if (price[i] != abi::uniswap_v3::sqrt_price_x96_to_price(cols.sqrtPriceX96[i], 1e12)) return false;
+        }
+        // Out-of-range sqrtPriceX96 (above uint160) is rejected
+        std::vector<uint8_t> bad(160, 0);
+        bad[64 + 11] = 1;
+        abi::Error err;
+        return !abi::uniswap_v3::decode_swap(abi::BytesSpan(bad.data(), bad.size()), cols, &err) &&
+               err.message == "swap: value out of range" && cols.size() == sqrtp.size();
+      })());
+
+    RUN_TEST("Slot0 price column matches the single-value form",
+      ([&](){
+        std::vector<abi::uniswap_v3::Slot0> states(9);
+        for (size_t i = 0; i < states.size(); ++i) {
+          abi::u256_from_cpp_int((cpp_int(1) << 96) * (i + 1) / 3, states[i].sqrtPriceX96);
+        }
+        std::vector<double> price(states.size());
+        abi::uniswap_v3::sqrt_price_x96_to_price(states, price.data());
+        for (size_t i = 0; i < states.size(); ++i)
+          if (price[i] != abi::uniswap_v3::sqrt_price_x96_to_price(states[i].sqrtPriceX96)) return false;
+        return price[2] == 1.0;
+      })());
+  }
+
+  // ────────────────────────────────────────────────────────────────────────────
+  //  Runtime ABI loader (abi/dyn.h)
+  // ────────────────────────────────────────────────────────────────────────────
+  std::cout << "\n== runtime ABI (dyn) ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    using abi::dyn::Value;
+    namespace P = abi::protocols;
+
+    abi::dyn::Abi erc20, multicall, ticklens, pool;
+    abi::Error load_err;
+    const bool loaded = abi::dyn::Abi::load_file("../abis/erc20.json", erc20, &load_err) &&
+                        abi::dyn::Abi::load_file("../abis/multicall.json", multicall, &load_err) &&
+                        abi::dyn::Abi::load_file("../abis/uniswap_v3_tick_lens.json", ticklens, &load_err) &&
+                        abi::dyn::Abi::load_file("../abis/uniswap_v3_pool.json", pool, &load_err);
+    if (!loaded) std::cerr << "ABI load failed: " << load_err.message << "\n";
+
+    RUN_TEST("dyn: selectors and topics match generated protocols.h",
+      ([&](){
+        if (!loaded) return false;
+        auto sel = [](const abi::dyn::Abi& a, const char* n) {
+          auto f = a.function(n);
+          return f ? f->selector : std::array<uint8_t, 4>{};
+        };
+        auto transfer = erc20.event("Transfer");
+        return sel(erc20, "balanceOf") == P::Sel_ERC20_balanceOf::value &&
+               sel(erc20, "transferFrom") == P::Sel_ERC20_transferFrom::value &&
+               sel(multicall, "aggregate3") == P::Sel_Multicall_aggregate3::value &&
+               sel(multicall, "tryAggregate") == P::Sel_Multicall_tryAggregate::value &&
+               multicall.function("aggregate3")->signature == "aggregate3((address,bool,bytes)[])" &&
+               transfer && transfer->topic0 == P::Topic_ERC20_Transfer::value &&
+               transfer->data.children.size() == 1;
+      })());
+
+    RUN_TEST("dyn: type strings parse to canonical form",
+      ([&](){
+        abi::dyn::TypeDesc t;
+        for (const char* s : {"uint256", "int24", "address[]", "(int24,int128,uint128)[]",
+                              "bytes32[2][]", "(address,(bool,string)[3])"}) {
+          if (!abi::dyn::TypeDesc::parse(s, t) || t.canonical() != s) return false;
+        }
+        abi::dyn::TypeDesc::parse("uint", t);
+        return t.canonical() == "uint256" && !abi::dyn::TypeDesc::parse("uint7", t) &&
+               !abi::dyn::TypeDesc::parse("(uint8", t) && !abi::dyn::TypeDesc::parse("foo[]", t);
+      })());
+
+    const auto holder = abi::addr_from_hex("0x1111111111111111111111111111111111111111");
+    const auto target = abi::addr_from_hex("0x8ad599c3a0ff1de082011efddc58f1908eb6e6d8");
+
+    RUN_TEST("dyn: encode_call byte-identical to template path",
+      ([&](){
+        if (!loaded) return false;
+        // transferFrom(address,address,uint256)
+        const cpp_int amount("123456789012345678901234567890");
+        std::vector<uint8_t> a(P::ERC20_TransferFrom::encoded_size(holder, target, amount));
+        P::ERC20_TransferFrom::encode_call<std::array<uint8_t, 20>, std::array<uint8_t, 20>, cpp_int>(
+            a.data(), a.size(), holder, target, amount);
+        auto f = erc20.function("transferFrom");
+        Value::List args{holder, target, amount};
+        std::vector<uint8_t> b(f->encoded_size(args));
+        if (!f->encode_call(b.data(), b.size(), args) || a != b) return false;
+
+        // aggregate3((address,bool,bytes)[])
+        std::vector<P::Multicall3_Call3> calls{{target, true, {0x0d, 0xfe, 0x16, 0x81}},
+                                               {holder, false, std::vector<uint8_t>(37, 0xee)}};
+        std::vector<uint8_t> c(Aggregate3::encoded_size(calls));
+        Aggregate3::encode_call<std::vector<P::Multicall3_Call3>>(c.data(), c.size(), calls);
+        Value::List list;
+        for (const auto& cl : calls) list.push_back(Value::List{cl.target, cl.allowFailure, cl.callData});
+        Value::List margs{Value(list)};
+        auto agg = multicall.function("aggregate3");
+        std::vector<uint8_t> d(agg->encoded_size(margs));
+        if (!agg->encode_call(d.data(), d.size(), margs) || c != d) return false;
+
+        // decode_call recovers the arguments
+        Value::List back;
+        return agg->decode_call(abi::BytesSpan(d.data(), d.size()), back) && back == margs;
+      })());
+
+    RUN_TEST("dyn: decode_result matches template decode (ticks, slot0)",
+      ([&](){
+        if (!loaded) return false;
+        std::vector<P::ITickLens_PopulatedTick> ticks{{-887220, -5, 5}, {60, cpp_int(1) << 100, cpp_int(1) << 101}};
+        using TickArray = abi::dyn_array<P::ITickLens_PopulatedTick>;
+        std::vector<uint8_t> buf(abi::encoded_size<TickArray>(ticks));
+        abi::encode_into<TickArray>(buf.data(), buf.size(), ticks);
+        Value::List out;
+        auto f = ticklens.function("getPopulatedTicksInWord");
+        if (!f || !f->decode_result(abi::BytesSpan(buf.data(), buf.size()), out)) return false;
+        const auto& arr = out.at(0).as_list();
+        if (arr.size() != 2 || arr[0].as_list()[0].as_int() != -887220 ||
+            arr[0].as_list()[1].as_int() != -5 || arr[1].as_list()[2].as_int() != (cpp_int(1) << 101))
+          return false;
+        // Re-encoding the decoded values reproduces the payload
+        size_t n = 0;
+        if (!abi::dyn::encoded_size(f->outputs, out, n) || n != buf.size()) return false;
+        std::vector<uint8_t> re(n);
+        if (!abi::dyn::encode(f->outputs, out, re.data(), re.size()) || re != buf) return false;
+
+        auto s0 = pool.function("slot0");
+        P::IUniswapV3Pool_Slot0 slot{cpp_int(1) << 96, -1, 2, 3, 4, 5, true};
+        std::vector<uint8_t> sb(abi::encoded_size<P::IUniswapV3Pool_Slot0>(slot));
+        abi::encode_into<P::IUniswapV3Pool_Slot0>(sb.data(), sb.size(), slot);
+        Value::List so;
+        return s0 && s0->decode_result(abi::BytesSpan(sb.data(), sb.size()), so) && so.size() == 7 &&
+               so[0].as_int() == (cpp_int(1) << 96) && so[1].as_int() == -1 && so[6].as_bool();
+      })());
+
+    RUN_TEST("dyn: compiled plans are cached and match traits<> on nested types",
+      ([&](){
+        using S = abi::tuple<abi::static_array<abi::tuple<abi::uint_t<8>, abi::bool_t>, 2>,
+                             abi::dyn_array<abi::string_t>,
+                             abi::static_array<abi::bytes, 2>,
+                             abi::int_t<64>>;
+        abi::cpp_t<S> v;
+        std::get<0>(v)[0] = {7, true};
+        std::get<0>(v)[1] = {255, false};
+        std::get<1>(v) = {"a", "", std::string(70, 'z')};
+        std::get<2>(v) = {{{1, 2, 3}, std::vector<uint8_t>(33, 9)}};
+        std::get<3>(v) = -42;
+        std::vector<uint8_t> expect(abi::encoded_size<S>(v));
+        abi::encode_into<S>(expect.data(), expect.size(), v);
+
+        abi::dyn::TypeDesc params;
+        if (!abi::dyn::TypeDesc::parse("(((uint8,bool)[2],string[],bytes[2],int64))", params)) return false;
+        auto plan = abi::dyn::plan_for(params);
+        abi::dyn::TypeDesc same;
+        abi::dyn::TypeDesc::parse("(((uint8,bool)[2],string[],bytes[2],int64))", same);
+        if (abi::dyn::plan_for(same) != plan) return false;
+
+        Value::List inner{
+            Value::List{Value::List{7, true}, Value::List{255, false}},
+            Value::List{"a", "", std::string(70, 'z')},
+            Value::List{std::vector<uint8_t>{1, 2, 3}, std::vector<uint8_t>(33, 9)},
+            cpp_int(-42)};
+        Value::List args{Value(inner)};
+        size_t n = 0;
+        if (!plan->encoded_size(args, n) || n != expect.size()) return false;
+        std::vector<uint8_t> got(n);
+        if (!plan->encode(args, got.data(), got.size()) || got != expect) return false;
+        Value::List back;
+        return plan->decode(abi::BytesSpan(got.data(), got.size()), back) && back == args;
+      })());
+
+    RUN_TEST("dyn: mismatched values and malformed input are rejected",
+      ([&](){
+        if (!loaded) return false;
+        auto f = erc20.function("transfer");
+        abi::Error err;
+        std::vector<uint8_t> out(256);
+        if (f->encode_call(out.data(), out.size(), Value::List{holder}, &err)) return false;
+        if (f->encode_call(out.data(), out.size(), Value::List{cpp_int(1), cpp_int(1)}, &err) ||
+            err.message != "dyn: value does not match address")
+          return false;
+        abi::dyn::Abi bad;
+        return !abi::dyn::Abi::parse("[{\"type\":\"function\",\"name\":\"f\",\"inputs\":[{\"type\":\"uint7\"}]}]", bad, &err) &&
+               !abi::dyn::Abi::parse("[{", bad, &err);
+      })());
+
+    RUN_TEST("dyn: empty tuples are rejected as elements and components",
+      ([&](){
+        abi::dyn::TypeDesc t;
+        if (abi::dyn::TypeDesc::parse("(()[])", t) || abi::dyn::TypeDesc::parse("()[2]", t) ||
+            abi::dyn::TypeDesc::parse("(uint8,())", t) || !abi::dyn::TypeDesc::parse("()", t))
+          return false;
+        abi::Error err;
+        abi::dyn::Abi bad;
+        if (abi::dyn::Abi::parse("[{\"type\":\"function\",\"name\":\"f\",\"inputs\":"
+                                 "[{\"type\":\"tuple[]\",\"components\":[]}]}]", bad, &err) ||
+            err.message != "dyn: empty tuple")
+          return false;
+        // A hand-built plan with a zero-size element must not divide by zero
+        abi::dyn::TypeDesc elem, arr, params;
+        elem.kind = abi::dyn::Kind::Tuple;
+        elem.finalize();
+        arr.kind = abi::dyn::Kind::DynArray;
+        arr.children.push_back(elem);
+        arr.finalize();
+        params.kind = abi::dyn::Kind::Tuple;
+        params.children.push_back(arr);
+        params.finalize();
+        std::vector<uint8_t> buf(64);
+        buf[31] = 0x20;
+        buf[63] = 5;
+        Value::List out;
+        abi::dyn::plan_for(params)->decode(abi::BytesSpan(buf.data(), buf.size()), out);
+        return true;
+      })());
+  }
+
+  // ────────────────────────────────────────────────────────────────────────────
+  //  Calldata decoding (Fn::decode_call)
+  // ────────────────────────────────────────────────────────────────────────────
+  std::cout << "\n== calldata decoding ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    namespace P = abi::protocols;
+
+    RUN_TEST("decode_call round-trips transferFrom",
+      ([&](){
+        std::array<uint8_t, 20> from{}, to{};
+        from.fill(0x11);
+        to.fill(0x22);
+        const cpp_int amount = (cpp_int(1) << 200) + 7;
+        std::vector<uint8_t> cd(P::ERC20_TransferFrom::encoded_size(from, to, amount));
+        if (!P::ERC20_TransferFrom::encode_call<std::array<uint8_t, 20>, std::array<uint8_t, 20>, cpp_int>(
+                cd.data(), cd.size(), from, to, amount))
+          return false;
+        std::array<uint8_t, 20> f2{}, t2{};
+        cpp_int a2;
+        if (!P::ERC20_TransferFrom::decode_call(abi::BytesSpan(cd.data(), cd.size()), f2, t2, a2))
+          return false;
+        P::ERC20_TransferFrom::args_t tup;
+        return f2 == from && t2 == to && a2 == amount &&
+               P::ERC20_TransferFrom::decode_call(abi::BytesSpan(cd.data(), cd.size()), tup) &&
+               std::get<2>(tup) == amount;
+      })());
+
+    RUN_TEST("decode_call recovers swapExactTokensForTokens path",
+      ([&](){
+        using Swap = P::UniswapV2Router_SwapExactTokensForTokens;
+        std::vector<std::array<uint8_t, 20>> path(3);
+        for (size_t i = 0; i < path.size(); ++i) path[i].fill(static_cast<uint8_t>(0xa0 + i));
+        std::array<uint8_t, 20> to{};
+        to.fill(0x77);
+        const cpp_int in_amt = cpp_int("1000000000000000000"), min_out = 12345, deadline = 1700000000;
+        std::vector<uint8_t> cd(Swap::encoded_size(in_amt, min_out, path, to, deadline));
+        if (!Swap::encode_call<cpp_int, cpp_int, std::vector<std::array<uint8_t, 20>>,
+                               std::array<uint8_t, 20>, cpp_int>(cd.data(), cd.size(), in_amt,
+                                                                 min_out, path, to, deadline))
+          return false;
+        cpp_int a, b, d;
+        std::vector<std::array<uint8_t, 20>> p2;
+        std::array<uint8_t, 20> t2{};
+        return Swap::decode_call(abi::BytesSpan(cd.data(), cd.size()), a, b, p2, t2, d) &&
+               a == in_amt && b == min_out && p2 == path && t2 == to && d == deadline;
+      })());
+
+    RUN_TEST("decode_call recovers aggregate3 inner calls",
+      ([&](){
+        std::vector<P::Multicall3_Call3> calls(4);
+        for (size_t i = 0; i < calls.size(); ++i) {
+          calls[i].target.fill(static_cast<uint8_t>(i + 1));
+          calls[i].allowFailure = i % 2;
+          calls[i].callData.assign(4 + 32 * i, static_cast<uint8_t>(0x30 + i));
+        }
+        std::vector<uint8_t> cd(P::Multicall_Aggregate3::encoded_size(calls));
+        if (!P::Multicall_Aggregate3::encode_call<std::vector<P::Multicall3_Call3>>(cd.data(), cd.size(), calls))
+          return false;
+        std::vector<P::Multicall3_Call3> back;
+        if (!P::Multicall_Aggregate3::decode_call(abi::BytesSpan(cd.data(), cd.size()), back) ||
+            back.size() != calls.size())
+          return false;
+        for (size_t i = 0; i < calls.size(); ++i)
+          if (back[i].target != calls[i].target || back[i].allowFailure != calls[i].allowFailure ||
+              back[i].callData != calls[i].callData)
+            return false;
+        return true;
+      })());
+
+    RUN_TEST("decode_call rejects wrong selector, short heads and bad offsets",
+      ([&](){
+        std::array<uint8_t, 20> holder{};
+        std::vector<uint8_t> cd(P::ERC20_BalanceOf::encoded_size(holder));
+        P::ERC20_BalanceOf::encode_call<std::array<uint8_t, 20>>(cd.data(), cd.size(), holder);
+        abi::Error err;
+        std::array<uint8_t, 20> out{};
+        std::vector<uint8_t> bad = cd;
+        bad[0] ^= 1;
+        if (P::ERC20_BalanceOf::decode_call(abi::BytesSpan(bad.data(), bad.size()), out, &err) ||
+            err.message != "call: selector mismatch")
+          return false;
+        if (P::ERC20_BalanceOf::decode_call(abi::BytesSpan(cd.data(), 20), out, &err) ||
+            err.message != "call: head short")
+          return false;
+        std::vector<P::Multicall3_Call3> calls(1);
+        std::vector<uint8_t> agg(P::Multicall_Aggregate3::encoded_size(calls));
+        P::Multicall_Aggregate3::encode_call<std::vector<P::Multicall3_Call3>>(agg.data(), agg.size(), calls);
+        agg[4 + 31] = 0xff;  // offset past the end
+        std::vector<P::Multicall3_Call3> back;
+        return !P::Multicall_Aggregate3::decode_call(abi::BytesSpan(agg.data(), agg.size()), back, &err) &&
+               err.message == "call: bad off";
+      })());
+  }
+
+  // ────────────────────────────────────────────────────────────────────────────
+  //  Selector registry (abi/registry.h)
+  // ────────────────────────────────────────────────────────────────────────────
+  std::cout << "\n== selector registry ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    namespace P = abi::protocols;
+
+    RUN_TEST("SelectorTable finds every key across growth and full groups",
+      ([&](){
+        abi::SelectorTable t(4);
+        uint32_t x = 12345;
+        std::vector<uint32_t> keys;
+        for (uint32_t i = 0; i < 5000; ++i) {
+          x = x * 1664525u + 1013904223u;
+          if (t.insert(x, i)) keys.push_back(x);
+        }
+        for (size_t i = 0; i < keys.size(); ++i)
+          if (t.find(keys[i]) == abi::SelectorTable::npos) return false;
+        // Keys differing only in the bits dropped by the hash land in the same group
+        abi::SelectorTable same;
+        for (uint32_t i = 0; i < 40; ++i)
+          if (!same.insert(i << 25, i)) return false;
+        for (uint32_t i = 0; i < 40; ++i)
+          if (same.find(i << 25) != i) return false;
+        return t.size() == keys.size() && !t.insert(keys[0], 7) && t.find(keys[0]) != 7 &&
+               same.find(0x01000000) == abi::SelectorTable::npos && same.find(0) == 0;
+      })());
+
+    RUN_TEST("Registry classifies every generated selector",
+      ([&](){
+        abi::Registry reg;
+        const size_t n = reg.add_protocols();
+        if (n != std::size(P::all_functions) || n != std::tuple_size<P::AllFunctions>::value)
+          return false;
+        for (const auto& f : P::all_functions) {
+          auto* ent = reg.find(f.selector);
+          if (!ent || ent->name != f.name) return false;
+        }
+        auto* bal = reg.find(P::Sel_ERC20_balanceOf::value);
+        abi::Error err;
+        std::array<uint8_t, 4> unknown{{0xde, 0xad, 0xbe, 0xef}};
+        return bal && bal->signature == "balanceOf(address)" && !reg.find(unknown) &&
+               !reg.dispatch(abi::BytesSpan(unknown.data(), 4), &err) &&
+               err.message == "registry: unknown selector" &&
+               !reg.add(P::Sel_ERC20_balanceOf::value, "dup", "", {}, &err) &&
+               err.message == "registry: duplicate selector" && reg.add_protocols() == 0;
+      })());
+
+    RUN_TEST("Registry dispatches typed and runtime handlers",
+      ([&](){
+        using Swap = P::UniswapV2Router_SwapExactTokensForTokens;
+        abi::Registry reg;
+        reg.add_protocols();
+        size_t path_len = 0;
+        cpp_int seen_amount;
+        reg.on<Swap>([&](const cpp_int& in, const cpp_int&, const auto& path, const auto&, const cpp_int&) {
+          seen_amount = in;
+          path_len = path.size();
+        });
+        std::vector<std::array<uint8_t, 20>> path(3);
+        std::array<uint8_t, 20> to{};
+        const cpp_int amt = 5000, min_out = 1, deadline = 99;
+        std::vector<uint8_t> cd(Swap::encoded_size(amt, min_out, path, to, deadline));
+        Swap::encode_call<cpp_int, cpp_int, std::vector<std::array<uint8_t, 20>>, std::array<uint8_t, 20>,
+                          cpp_int>(cd.data(), cd.size(), amt, min_out, path, to, deadline);
+        if (!reg.dispatch(abi::BytesSpan(cd.data(), cd.size())) || seen_amount != amt || path_len != 3)
+          return false;
+        // Truncated calldata surfaces the decoder error
+        abi::Error err;
+        if (reg.dispatch(abi::BytesSpan(cd.data(), 40), &err) || err.message != "call: head short")
+          return false;
+
+        abi::dyn::Abi custom;
+        if (!abi::dyn::Abi::parse("[{\"type\":\"function\",\"name\":\"poke\",\"inputs\":[{\"type\":\"uint64\"},{\"type\":\"string\"}]}]",
+                                  custom))
+          return false;
+        const auto* poke = custom.function("poke");
+        std::string label;
+        if (!reg.on(*poke, [&](const abi::dyn::Function& f, const abi::dyn::Value::List& args) {
+              label = f.name + ":" + args[1].as_string();
+              return args[0].as_int() == 42;
+            }))
+          return false;
+        std::vector<uint8_t> pc(poke->encoded_size({42, "hi"}));
+        poke->encode_call(pc.data(), pc.size(), {42, "hi"});
+        if (!reg.dispatch(abi::BytesSpan(pc.data(), pc.size())) || label != "poke:hi") return false;
+        pc.assign(poke->encoded_size({41, "x"}), 0);
+        poke->encode_call(pc.data(), pc.size(), {41, "x"});
+        return !reg.dispatch(abi::BytesSpan(pc.data(), pc.size())) &&
+               reg.find(abi::BytesSpan(pc.data(), pc.size()))->signature == "poke(uint64,string)";
+      })());
+  }
+
+  // ────────────────────────────────────────────────────────────────────────────
+  //  Multicall calldata unwrapping (multicall::CallsView)
+  // ────────────────────────────────────────────────────────────────────────────
+  std::cout << "\n== multicall unwrapping ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    namespace P = abi::protocols;
+    namespace M = abi::multicall;
+    using Addr = std::array<uint8_t, 20>;
+    using Router_Multicall = abi::Fn<M::Sel_Router_multicall, abi::dyn_array<abi::bytes>, abi::dyn_array<abi::bytes>>;
+    using Swap = P::UniswapV2Router_SwapExactTokensForTokens;
+
+    auto addr = [](uint8_t b) { Addr a; a.fill(b); return a; };
+    auto transfer = [&](uint8_t to, const cpp_int& amt) {
+      std::vector<uint8_t> cd(P::ERC20_Transfer::encoded_size(addr(to), amt));
+      P::ERC20_Transfer::encode_call<Addr, cpp_int>(cd.data(), cd.size(), addr(to), amt);
+      return cd;
+    };
+    auto swap = [&](const cpp_int& amt) {
+      std::vector<Addr> path{addr(1), addr(2)};
+      const cpp_int min_out = 1, deadline = 2;
+      std::vector<uint8_t> cd(Swap::encoded_size(amt, min_out, path, addr(9), deadline));
+      Swap::encode_call<cpp_int, cpp_int, std::vector<Addr>, Addr, cpp_int>(cd.data(), cd.size(), amt, min_out,
+                                                                          path, addr(9), deadline);
+      return cd;
+    };
+    auto aggregate3 = [&](const std::vector<P::Multicall3_Call3>& calls) {
+      std::vector<uint8_t> cd(P::Multicall_Aggregate3::encoded_size(calls));
+      P::Multicall_Aggregate3::encode_call<std::vector<P::Multicall3_Call3>>(cd.data(), cd.size(), calls);
+      return cd;
+    };
+
+    RUN_TEST("router multicall selectors match their signatures",
+      ([&](){
+        return abi::selector_of("multicall(bytes[])") == M::Sel_Router_multicall::value &&
+               abi::selector_of("multicall(uint256,bytes[])") == M::Sel_Router_multicallDeadline::value;
+      })());
+
+    RUN_TEST("CallsView borrows aggregate3 entries from the calldata",
+      ([&](){
+        std::vector<P::Multicall3_Call3> calls{{addr(0xa1), true, transfer(0x10, 100)},
+                                               {addr(0xa2), false, transfer(0x20, 200)},
+                                               {addr(0xa3), true, {}}};
+        auto cd = aggregate3(calls);
+        M::CallsView view;
+        if (!M::CallsView::parse(abi::BytesSpan(cd.data(), cd.size()), view) || view.size() != 3 ||
+            view.kind() != M::CallsKind::aggregate3)
+          return false;
+        const uint8_t* lo = cd.data();
+        const uint8_t* hi = cd.data() + cd.size();
+        size_t i = 0;
+        for (M::CallRef c : view) {
+          if (c.callData.size() && (c.callData.data() < lo || c.callData.data() + c.callData.size() > hi))
+            return false;
+          if (!std::equal(c.target.begin(), c.target.end(), calls[i].target.begin()) ||
+              c.allowFailure != calls[i].allowFailure || c.callData.size() != calls[i].callData.size())
+            return false;
+          ++i;
+        }
+        P::ERC20_Transfer::args_t args;
+        return view[1].is<P::ERC20_Transfer>() && view[1].decode<P::ERC20_Transfer>(args) &&
+               std::get<0>(args) == addr(0x20) && std::get<1>(args) == 200 && !view[2].is<P::ERC20_Transfer>();
+      })());
+
+    RUN_TEST("CallsView reads tryAggregate and aggregate3Value layouts",
+      ([&](){
+        std::vector<P::Multicall3_Call> plain{{addr(0xb1), transfer(1, 5)}};
+        std::vector<uint8_t> t(P::Multicall_TryAggregate::encoded_size(true, plain));
+        P::Multicall_TryAggregate::encode_call<bool, std::vector<P::Multicall3_Call>>(t.data(), t.size(), true, plain);
+        M::CallsView tv;
+        if (!M::CallsView::parse(abi::BytesSpan(t.data(), t.size()), tv) || !tv.require_success() ||
+            tv.size() != 1 || tv[0].target.data()[0] != 0xb1 || tv[0].callData.size() != plain[0].callData.size())
+          return false;
+        std::vector<P::Multicall3_Call3Value> valued{{addr(0xc1), true, cpp_int(777), transfer(2, 6)}};
+        std::vector<uint8_t> v(P::Multicall_Aggregate3Value::encoded_size(valued));
+        P::Multicall_Aggregate3Value::encode_call<std::vector<P::Multicall3_Call3Value>>(v.data(), v.size(), valued);
+        M::CallsView vv;
+        return M::CallsView::parse(abi::BytesSpan(v.data(), v.size()), vv) && vv.size() == 1 &&
+               vv[0].allowFailure && vv[0].value.size() == 32 && abi::read_u256_big(vv[0].value.data()) == 777 &&
+               vv[0].callData.size() == valued[0].callData.size();
+      })());
+
+    RUN_TEST("for_each_call descends into nested multicalls and router multicalls",
+      ([&](){
+        std::vector<P::Multicall3_Call> inner{{addr(0xd1), transfer(3, 33)}, {addr(0xd2), transfer(4, 44)}};
+        std::vector<uint8_t> agg(P::Multicall_Aggregate::encoded_size(inner));
+        P::Multicall_Aggregate::encode_call<std::vector<P::Multicall3_Call>>(agg.data(), agg.size(), inner);
+        std::vector<std::vector<uint8_t>> routed{swap(1000), swap(2000)};
+        std::vector<uint8_t> rm(Router_Multicall::encoded_size(routed));
+        Router_Multicall::encode_call<std::vector<std::vector<uint8_t>>>(rm.data(), rm.size(), routed);
+        auto cd = aggregate3({{addr(0xe0), true, agg}, {addr(0xe1), false, rm}, {addr(0xe2), true, transfer(5, 55)}});
+        const abi::BytesSpan in(cd.data(), cd.size());
+
+        std::vector<std::pair<uint8_t, size_t>> seen;  // (first target byte, depth)
+        if (!M::for_each_call(in, [&](const M::CallRef& c, size_t depth) {
+              seen.emplace_back(c.target.data()[0], depth);
+              return true;
+            }))
+          return false;
+        const std::vector<std::pair<uint8_t, size_t>> expect{{0xd1, 1}, {0xd2, 1}, {0xe1, 1}, {0xe1, 1}, {0xe2, 0}};
+        if (seen != expect) return false;
+
+        size_t leaves = 0, stops = 0;
+        M::for_each_call(in, [&](const M::CallRef&, size_t) { ++leaves; return true; }, 1);
+        M::for_each_call(in, [&](const M::CallRef&, size_t) { return ++stops < 2; });
+
+        abi::Registry reg;
+        cpp_int swapped = 0;
+        size_t transfers = 0;
+        reg.on<Swap>([&](const cpp_int& a, const cpp_int&, const auto&, const auto&, const cpp_int&) { swapped += a; });
+        reg.on<P::ERC20_Transfer>([&](const Addr&, const cpp_int&) { ++transfers; });
+        return leaves == 3 && stops == 2 && reg.dispatch_nested(in) && swapped == 3000 && transfers == 3;
+      })());
+
+    RUN_TEST("CallsView rejects non-multicall and malformed calldata",
+      ([&](){
+        abi::Error err;
+        M::CallsView view;
+        auto t = transfer(1, 1);
+        if (M::CallsView::parse(abi::BytesSpan(t.data(), t.size()), view, &err) ||
+            err.message != "calls: not a multicall")
+          return false;
+        auto cd = aggregate3({{addr(1), true, transfer(1, 1)}});
+        auto bad = cd;
+        bad[4 + 32 + 32 + 31] = 0xf0;  // element offset past the end
+        if (M::CallsView::parse(abi::BytesSpan(bad.data(), bad.size()), view, &err) || err.message != "calls: bad off")
+          return false;
+        return !M::CallsView::parse(abi::BytesSpan(cd.data(), cd.size() - 40), view, &err);
+      })());
+  }
+
+  // ────────────────────────────────────────────────────────────────────────────
+  //  JSON output (abi/json.h)
+  // ────────────────────────────────────────────────────────────────────────────
+  std::cout << "\n== JSON output ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    namespace P = abi::protocols;
+    char buf[4096];
+
+    auto json = [&](auto write) {
+      abi::BufferSink sink(buf, sizeof(buf));
+      write(sink);
+      return std::string(sink.view());
+    };
+
+    RUN_TEST("to_json writes named structs as objects",
+      ([&](){
+        P::IUniswapV3Pool_Slot0 s0{cpp_int(1) << 96, -887272, 1, 2, 3, 4, true};
+        const std::string dec = json([&](auto& k) { abi::to_json<P::IUniswapV3Pool_Slot0>(s0, k); });
+        abi::JsonOptions hex;
+        hex.hex_numbers = true;
+        const std::string hx = json([&](auto& k) { abi::to_json<P::IUniswapV3Pool_Slot0>(s0, k, hex); });
+        return dec ==
+                   "{\"sqrtPriceX96\":\"79228162514264337593543950336\",\"tick\":\"-887272\","
+                   "\"observationIndex\":\"1\",\"observationCardinality\":\"2\","
+                   "\"observationCardinalityNext\":\"3\",\"feeProtocol\":\"4\",\"unlocked\":true}" &&
+               hx.rfind("{\"sqrtPriceX96\":\"0x1000000000000000000000000\",\"tick\":\"-0xd89e8\",", 0) == 0;
+      })());
+
+    RUN_TEST("to_json formats 256-bit extremes, bytes, strings and addresses",
+      ([&](){
+        using S = abi::tuple<abi::uint_t<256>, abi::int_t<256>, abi::bytes, abi::string_t, abi::address20>;
+        std::array<uint8_t, 20> a{};
+        for (int i = 0; i < 20; ++i) a[i] = static_cast<uint8_t>(i);
+        auto v = std::make_tuple((cpp_int(1) << 256) - 1, -(cpp_int(1) << 255), std::vector<uint8_t>{0xde, 0xad},
+                                 std::string("q\"\\\n\x01"), a);
+        const std::string out = json([&](auto& k) { abi::to_json<S>(v, k); });
+        return out ==
+               "[\"115792089237316195423570985008687907853269984665640564039457584007913129639935\","
+               "\"-57896044618658097711785492504343953926634992332820282019728792003956564819968\","
+               "\"0xdead\",\"q\\\"\\\\\\n\\u0001\",\"0x000102030405060708090a0b0c0d0e0f10111213\"]";
+      })());
+
+    RUN_TEST("to_json checksums addresses per EIP-55",
+      ([&](){
+        abi::JsonOptions opt;
+        opt.checksum_addresses = true;
+        const char* vectors[] = {"5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed", "fB6916095ca1df60bB79Ce92cE3Ea74c37c5d359",
+                                 "dbF03B407c01E7cD3CBea99509d93f8DDDC8C6FB", "D1220A0cf47c7B9Be7A2E6BA89F429762e7b9aDb"};
+        for (const char* v : vectors) {
+          auto addr = abi::addr_from_hex(v);
+          if (json([&](auto& k) { abi::to_json<abi::address20>(addr, k, opt); }) != "\"0x" + std::string(v) + "\"")
+            return false;
+        }
+        return true;
+      })());
+
+    RUN_TEST("to_json_view matches to_json on encoded payloads",
+      ([&](){
+        std::vector<P::ITickLens_PopulatedTick> ticks(3);
+        for (int i = 0; i < 3; ++i) {
+          ticks[i].tick = -60 * i;
+          ticks[i].liquidityNet = (i % 2 ? -1 : 1) * (cpp_int(1) << (40 + i));
+          ticks[i].liquidityGross = cpp_int(1) << (40 + i);
+        }
+        using TickArray = abi::dyn_array<P::ITickLens_PopulatedTick>;
+        std::vector<uint8_t> enc(abi::encoded_size<TickArray>(ticks));
+        abi::encode_into<TickArray>(enc.data(), enc.size(), ticks);
+        const std::string a = json([&](auto& k) { abi::to_json<TickArray>(ticks, k); });
+        std::string b = json([&](auto& k) { abi::to_json_view<TickArray>(abi::BytesSpan(enc.data(), enc.size()), k); });
+        if (a != b || a.find("\"liquidityNet\":\"-2199023255552\"") == std::string::npos) return false;
+
+        std::vector<P::Multicall3_Result> results{{true, {1, 2, 3}}, {false, {}}};
+        using Results = abi::dyn_array<P::Multicall3_Result>;
+        enc.assign(abi::encoded_size<Results>(results), 0);
+        abi::encode_into<Results>(enc.data(), enc.size(), results);
+        abi::JsonOptions opt;
+        opt.hex_numbers = true;
+        const std::string c = json([&](auto& k) { abi::to_json<Results>(results, k, opt); });
+        const std::string d =
+            json([&](auto& k) { abi::to_json_view<Results>(abi::BytesSpan(enc.data(), enc.size()), k, opt); });
+        abi::Error err;
+        abi::BufferSink sink(buf, sizeof(buf));
+        return c == d && c == "[{\"success\":true,\"returnData\":\"0x010203\"},{\"success\":false,\"returnData\":\"0x\"}]" &&
+               !abi::to_json_view<Results>(abi::BytesSpan(enc.data(), 40), sink, opt, &err);
+      })());
+
+    RUN_TEST("BufferSink reports the size needed after overflow",
+      ([&](){
+        std::vector<cpp_int> v{1, 22, 333};
+        char small[8];
+        abi::BufferSink sink(small, sizeof(small));
+        abi::to_json<abi::dyn_array<abi::uint_t<256>>>(v, sink);
+        return !sink.ok() && sink.size() == std::strlen("[\"1\",\"22\",\"333\"]") &&
+               sink.view() == std::string_view("[\"1\",\"22\"", 8);
+      })());
+  }
+
+  // ────────────────────────────────────────────────────────────────────────────
+  //  Hex payload decoding (abi/hex.h)
+  // ────────────────────────────────────────────────────────────────────────────
+  std::cout << "\n== hex payload decoding ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    namespace P = abi::protocols;
+
+    RUN_TEST("decode_hex decodes static results from the hex text",
+      ([&](){
+        P::IUniswapV3Pool_Slot0 s0{cpp_int(1) << 96, -5, 1, 2, 3, 4, true};
+        std::vector<uint8_t> enc(abi::encoded_size<P::IUniswapV3Pool_Slot0>(s0));
+        abi::encode_into<P::IUniswapV3Pool_Slot0>(enc.data(), enc.size(), s0);
+        std::string hex = abi::bytes_to_hex_string(enc);
+        P::IUniswapV3Pool_Slot0 out;
+        if (!abi::decode_hex<P::IUniswapV3Pool_Slot0>(hex, out) || out.tick != -5 ||
+            out.sqrtPriceX96 != s0.sqrtPriceX96 || !out.unlocked)
+          return false;
+        // Upper-case digits and no prefix are accepted
+        std::string upper = hex.substr(2);
+        for (char& c : upper) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        cpp_int bal;
+        return abi::decode_hex<P::IUniswapV3Pool_Slot0>(upper, out) && out.feeProtocol == 4 &&
+               abi::decode_hex<abi::uint_t<256>>("0x" + std::string(62, '0') + "Ff", bal) && bal == 255;
+      })());
+
+    RUN_TEST("decode_hex decodes dynamic results through reusable scratch",
+      ([&](){
+        std::vector<P::ITickLens_PopulatedTick> ticks(5);
+        for (int i = 0; i < 5; ++i) {
+          ticks[i].tick = -i;
+          ticks[i].liquidityNet = -(cpp_int(1) << (70 + i));
+          ticks[i].liquidityGross = cpp_int(1) << (70 + i);
+        }
+        using TickArray = abi::dyn_array<P::ITickLens_PopulatedTick>;
+        std::vector<uint8_t> enc(abi::encoded_size<TickArray>(ticks));
+        abi::encode_into<TickArray>(enc.data(), enc.size(), ticks);
+        const std::string hex = abi::bytes_to_hex_string(enc);
+        std::vector<uint8_t> scratch;
+        std::vector<P::ITickLens_PopulatedTick> out;
+        if (!abi::decode_hex<TickArray>(hex, out, scratch) || out.size() != 5 || out[4].liquidityNet != ticks[4].liquidityNet)
+          return false;
+        const uint8_t* first = scratch.data();
+        out.clear();
+        return abi::decode_hex<TickArray>(hex, out, scratch) && scratch.data() == first && out.size() == 5;
+      })());
+
+    RUN_TEST("hex_to_span feeds zero-copy views",
+      ([&](){
+        std::vector<P::Multicall3_Result> results{{true, {9, 8}}, {false, {}}};
+        using Results = abi::dyn_array<P::Multicall3_Result>;
+        std::vector<uint8_t> enc(abi::encoded_size<Results>(results));
+        abi::encode_into<Results>(enc.data(), enc.size(), results);
+        std::vector<uint8_t> scratch;
+        abi::BytesSpan span;
+        abi::multicall::ResultsView view;
+        return abi::hex_to_span(abi::bytes_to_hex_string(enc), scratch, span) &&
+               abi::multicall::ResultsView::parse(span, view) && view.size() == 2 && view[0].success &&
+               view[0].returnData.size() == 2 && view[0].returnData[1] == 8;
+      })());
+
+    RUN_TEST("decode_hex reports invalid characters, odd length and short input",
+      ([&](){
+        abi::Error err;
+        cpp_int v;
+        std::string hex = "0x" + std::string(64, '0');
+        hex[2 + 37] = 'g';
+        if (abi::decode_hex<abi::uint_t<256>>(hex, v, &err) || err.message != "hex: invalid character" ||
+            err.offset != 39)
+          return false;
+        std::vector<uint8_t> bytes_out;
+        std::vector<uint8_t> scratch;
+        if (abi::decode_hex<abi::bytes>("0x123", bytes_out, scratch, &err) || err.message != "hex: odd length")
+          return false;
+        if (abi::decode_hex<abi::uint_t<256>>("0x00ff", v, &err) || err.message != "hex: short") return false;
+        abi::BytesSpan span;
+        return !abi::hex_to_span("0xzz", scratch, span, &err) && err.offset == 2;
+      })());
+
+    RUN_TEST("decode_hex checks the text past a static head",
+      ([&](){
+        abi::Error err;
+        cpp_int v;
+        const std::string word = "0x" + std::string(62, '0') + "2a";
+        if (abi::decode_hex<abi::uint_t<256>>(word + "zz!", v, &err)) return false;
+        if (abi::decode_hex<abi::uint_t<256>>(word + "zz!!", v, &err) ||
+            err.code != abi::ErrorCode::invalid_text || err.offset != 66)
+          return false;
+        if (abi::decode_hex<abi::uint_t<256>>(word + "0", v, &err) || err.message != "hex: odd length")
+          return false;
+        if (abi::decode_hex<abi::uint_t<256>>(word + "0g", v, &err) || err.offset != 67) return false;
+        return abi::decode_hex<abi::uint_t<256>>(word + "00ff", v, &err) && v == 42;
+      })());
+
+    RUN_TEST("hex_encode matches the scalar table for all lengths and in place",
+      ([&](){
+        std::vector<uint8_t> data(300);
+        for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<uint8_t>(i * 37 + 11);
+        for (size_t n = 0; n <= data.size(); n += (n < 70 ? 1 : 29)) {
+          std::string out(2 * n, '?');
+          abi::hex_encode(data.data(), n, out.data());
+          if ("0x" + out != abi::bytes_to_hex_string(abi::BytesSpan(data.data(), n))) return false;
+          // Bytes parked in the back half expand into the same buffer
+          std::vector<char> buf(2 * n + 1);
+          std::memcpy(buf.data() + n, data.data(), n);
+          abi::hex_encode(reinterpret_cast<const uint8_t*>(buf.data() + n), n, buf.data());
+          if (std::string(buf.data(), 2 * n) != out) return false;
+        }
+        return true;
+      })());
+
+    RUN_TEST("encode_call_hex writes 0x-prefixed calldata",
+      ([&](){
+        std::array<uint8_t, 20> holder{};
+        for (int i = 0; i < 20; ++i) holder[i] = static_cast<uint8_t>(0xf0 + i);
+        std::vector<uint8_t> bin(P::ERC20_BalanceOf::encoded_size(holder));
+        P::ERC20_BalanceOf::encode_call<std::array<uint8_t, 20>>(bin.data(), bin.size(), holder);
+        std::string hex(P::ERC20_BalanceOf::encoded_hex_size(holder), '?');
+        if (!P::ERC20_BalanceOf::encode_call_hex<std::array<uint8_t, 20>>(hex.data(), hex.size(), holder) ||
+            hex != abi::bytes_to_hex_string(bin) || hex.compare(0, 10, "0x70a08231") != 0)
+          return false;
+
+        std::vector<P::Multicall3_Call3> calls(3);
+        for (size_t i = 0; i < calls.size(); ++i) {
+          calls[i].target.fill(static_cast<uint8_t>(0xa0 + i));
+          calls[i].callData.assign(100 + i, static_cast<uint8_t>(0x5c + i));
+        }
+        bin.assign(P::Multicall_Aggregate3::encoded_size(calls), 0);
+        P::Multicall_Aggregate3::encode_call<std::vector<P::Multicall3_Call3>>(bin.data(), bin.size(), calls);
+        hex.assign(P::Multicall_Aggregate3::encoded_hex_size(calls), '?');
+        abi::Error err;
+        return P::Multicall_Aggregate3::encode_call_hex<std::vector<P::Multicall3_Call3>>(hex.data(), hex.size(),
+                                                                                          calls) &&
+               hex == abi::bytes_to_hex_string(bin) &&
+               !P::Multicall_Aggregate3::encode_call_hex<std::vector<P::Multicall3_Call3>>(hex.data(), hex.size() - 1,
+                                                                                           calls, &err) &&
+               err.message == "encode_call_hex: buffer too small";
+      })());
+
+    RUN_TEST("hex_decode round-trips every length and finds the first bad character",
+      ([&](){
+        static const char digits[] = "0123456789abcdefABCDEF";
+        std::string text(600, '0');
+        for (size_t i = 0; i < text.size(); ++i) text[i] = digits[(i * 7 + 3) % 22];
+        for (size_t n = 0; n <= 300; n += (n < 70 ? 1 : 23)) {
+          std::vector<uint8_t> out(n);
+          if (!abi::hex_decode(text.data(), 2 * n, out.data())) return false;
+          for (size_t i = 0; i < n; ++i) {
+            const auto nib = [](char c) { return c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10; };
+            if (out[i] != ((nib(text[2 * i]) << 4) | nib(text[2 * i + 1]))) return false;
+          }
+          // Every position, every lane, including the high-bit bytes
+          for (size_t bad = 0; bad < 2 * n; bad += (n < 40 ? 1 : 13)) {
+            for (char c : {'g', '/', ':', '@', 'G', '`', '\x80', '\xe1'}) {
+              std::string t = text.substr(0, 2 * n);
+              t[bad] = c;
+              if (bad + 5 < t.size()) t[bad + 5] = 'z';  // a later one is not reported
+              size_t at = ~size_t(0);
+              if (abi::hex_decode(t.data(), t.size(), out.data(), &at) || at != bad) return false;
+            }
+          }
+        }
+        return true;
+      })());
+
+    RUN_TEST("buffer variants of parse_hex, addr_from_hex and bytes_to_hex_string",
+      ([&](){
+        abi::Error err;
+        uint8_t buf[8];
+        size_t n = 0;
+        if (!abi::parse_hex("0xABC", buf, sizeof(buf), n) || n != 2 || buf[0] != 0x0a || buf[1] != 0xbc ||
+            abi::parse_hex("abc", buf, sizeof(buf), n) != true || buf[0] != 0x0a)
+          return false;
+        if (abi::parse_hex("0x00112233445566778899", buf, sizeof(buf), n, &err) ||
+            err.message != "hex: buffer too small")
+          return false;
+        if (abi::parse_hex("0xq1", buf, sizeof(buf), n, &err) || err.offset != 2 ||
+            abi::parse_hex("0x1q1", buf, sizeof(buf), n, &err) || err.offset != 3)
+          return false;
+
+        const std::string hex = "0x8ad599c3A0ff1De082011EFDDc58f1908eb6e6D8";
+        std::array<uint8_t, 20> a{};
+        if (!abi::addr_from_hex(hex, a, &err) || a != abi::addr_from_hex(hex)) return false;
+        if (abi::addr_from_hex(hex.substr(0, 41), a, &err) || err.message != "hex: address must be 40 digits")
+          return false;
+        std::string bad = hex;
+        bad[30] = 'x';
+        if (abi::addr_from_hex(bad, a, &err) || err.offset != 30) return false;
+
+        char text[42];
+        const abi::BytesSpan span(a.data(), a.size());
+        return abi::bytes_to_hex_string(span, text, sizeof(text)) == 42 &&
+               std::string(text, 42) == abi::addr_to_hex_string(a) &&
+               abi::bytes_to_hex_string(span, text, 41) == 0 &&
+               abi::parse_hex(std::string(text, 42)) == std::vector<uint8_t>(a.begin(), a.end());
+      })());
+  }
+
+  std::cout << "\n== EIP-55 checksums ==\n";
+  {
+    const char* vectors[] = {"0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed", "0xfB6916095ca1df60bB79Ce92cE3Ea74c37c5d359",
+                             "0xdbF03B407c01E7cD3CBea99509d93f8DDDC8C6FB", "0xD1220A0cf47c7B9Be7A2E6BA89F429762e7b9aDb",
+                             "0x52908400098527886E0F7030069857D2E4169EE7", "0xde709f2102306220921060314715629080e2fb77"};
+    auto sample = [](size_t i) {
+      std::array<uint8_t, 20> a;
+      for (size_t j = 0; j < 20; ++j) a[j] = static_cast<uint8_t>(i * 97 + j * 31 + 5);
+      return a;
+    };
+
+    RUN_TEST("addr_to_checksum_hex and addr_validate_checksum on the EIP-55 vectors",
+      ([&](){
+        for (const char* v : vectors) {
+          if (abi::addr_to_checksum_hex(abi::addr_from_hex(v)) != v || !abi::addr_validate_checksum(v) ||
+              !abi::addr_validate_checksum(std::string(v).substr(2)))
+            return false;
+        }
+        abi::Error err;
+        std::string bad = vectors[0];
+        bad[3] = 'A';  // 0x5a... -> 0x5A...
+        if (abi::addr_validate_checksum(bad, &err) || err.message != "hex: bad checksum" || err.offset != 3)
+          return false;
+        std::string lower = abi::addr_to_hex_string(abi::addr_from_hex(vectors[0]));
+        if (abi::addr_validate_checksum(lower, &err)) return false;
+        bad[10] = 'g';
+        if (abi::addr_validate_checksum(bad, &err) || err.message != "hex: invalid character" || err.offset != 10)
+          return false;
+        return !abi::addr_validate_checksum("0x1234", &err) && err.message == "hex: address must be 40 digits";
+      })());
+
+    RUN_TEST("keccak256_many matches keccak256 across block boundaries",
+      ([&](){
+        std::vector<uint8_t> data(11 * 300);
+        for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<uint8_t>(i * 13 + 1);
+        for (size_t len : {0, 1, 40, 135, 136, 137, 272, 300}) {
+          for (size_t count : {1, 2, 3, 4, 5, 11}) {
+            std::vector<uint8_t> many(32 * count), one(32);
+            abi::keccak256_many(data.data(), 300, len, count, many.data());
+            for (size_t k = 0; k < count; ++k) {
+              abi::keccak256(data.data() + 300 * k, len, one.data());
+              if (!std::equal(one.begin(), one.end(), many.begin() + 32 * k)) return false;
+            }
+          }
+        }
+        return true;
+      })());
+
+    RUN_TEST("batch checksum and validation agree with the single forms",
+      ([&](){
+        const size_t n = 37;
+        std::vector<std::array<uint8_t, 20>> addrs(n);
+        for (size_t i = 0; i < n; ++i) addrs[i] = sample(i);
+        std::string packed(42 * n, '?');
+        abi::addr_to_checksum_hex(addrs.data(), n, packed.data());
+        std::vector<std::string> text(n);
+        std::vector<std::string_view> views(n);
+        for (size_t i = 0; i < n; ++i) {
+          text[i] = packed.substr(42 * i, 42);
+          if (text[i] != abi::addr_to_checksum_hex(addrs[i])) return false;
+        }
+        // Flip the case of a letter, break a digit, cut one short
+        for (size_t i : {3, 20, 36}) {
+          for (char& c : text[i])
+            if (std::isalpha(static_cast<unsigned char>(c)) && c != 'x') { c ^= 0x20; break; }
+        }
+        text[7][9] = '!';
+        text[16].pop_back();
+        for (size_t i = 0; i < n; ++i) views[i] = text[i];
+        std::unique_ptr<bool[]> ok(new bool[n]);
+        if (abi::addr_validate_checksum(views.data(), n, ok.get()) != n - 5) return false;
+        for (size_t i = 0; i < n; ++i)
+          if (ok[i] != abi::addr_validate_checksum(views[i])) return false;
+        return !ok[3] && !ok[7] && !ok[16] && ok[0];
+      })());
+
+    RUN_TEST("to_json checksums address arrays in batches",
+      ([&](){
+        abi::JsonOptions opt;
+        opt.checksum_addresses = true;
+        std::vector<std::array<uint8_t, 20>> addrs(21);
+        for (size_t i = 0; i < addrs.size(); ++i) addrs[i] = sample(i);
+        std::string expect = "[";
+        for (size_t i = 0; i < addrs.size(); ++i)
+          expect += (i ? ",\"" : "\"") + abi::addr_to_checksum_hex(addrs[i]) + "\"";
+        expect += "]";
+        using Addrs = abi::dyn_array<abi::address20>;
+        std::vector<uint8_t> enc(abi::encoded_size<Addrs>(addrs));
+        abi::encode_into<Addrs>(enc.data(), enc.size(), addrs);
+        std::vector<char> buf(4096);
+        abi::BufferSink a(buf.data(), 2048), b(buf.data() + 2048, 2048);
+        abi::to_json<Addrs>(addrs, a, opt);
+        abi::Error err;
+        return abi::to_json_view<Addrs>(abi::BytesSpan(enc.data(), enc.size()), b, opt, &err) && a.view() == expect &&
+               b.view() == expect;
+      })());
+  }
+
+  std::cout << "\n== u256 decimal ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    const cpp_int max = (cpp_int(1) << 256) - 1;
+    std::vector<cpp_int> samples{0, 9, 10, 99, 100, cpp_int("18446744073709551615"), cpp_int("18446744073709551616"),
+                                 cpp_int("10000000000000000000"), cpp_int("9999999999999999999"),
+                                 cpp_int("1000000000000000000000000"), cpp_int(1) << 160, max};
+    for (int i = 1; i < 78; i += 7) samples.push_back(boost::multiprecision::pow(cpp_int(10), i) - 1);
+    for (int i = 1; i < 256; i += 13) samples.push_back((cpp_int(1) << i) * 3 / 7 + i);
+
+    RUN_TEST("u256_to_decimal matches cpp_int::str",
+      ([&](){
+        char buf[abi::u256_max_decimal];
+        for (const auto& x : samples) {
+          abi::u256 v;
+          if (!abi::u256_from_cpp_int(x, v) || v.to_cpp_int() != x) return false;
+          const size_t n = abi::u256_to_decimal(buf, v);
+          if (std::string(buf, n) != x.str() || abi::u256_to_decimal(buf, x) != n) return false;
+        }
+        abi::u256 v;
+        return abi::u256_to_decimal(buf, cpp_int(-5)) == 0 && abi::u256_to_decimal(buf, max + 1) == 0 &&
+               !abi::u256_from_cpp_int(max + 1, v);
+      })());
+
+    RUN_TEST("u256_from_decimal parses every length and round-trips",
+      ([&](){
+        for (const auto& x : samples) {
+          abi::u256 v;
+          cpp_int y;
+          const std::string str = x.str();
+          if (!abi::u256_from_decimal(str, v) || v.to_cpp_int() != x) return false;
+          if (!abi::u256_from_decimal("000" + str, y) || y != x) return false;
+        }
+        return true;
+      })());
+
+    RUN_TEST("u256_to_double rounds to nearest, ties to even",
+      ([&](){
+        auto conv = [](const cpp_int& x) {
+          abi::u256 v;
+          abi::u256_from_cpp_int(x, v);
+          return abi::u256_to_double(v);
+        };
+        const cpp_int p200 = cpp_int(1) << 200;
+        // ulp(2^200) is 2^148: a half-ulp tie goes to the even neighbour
+        if (conv(p200 + (cpp_int(1) << 147)) != std::ldexp(1.0, 200) ||
+            conv(p200 + (cpp_int(1) << 147) + 1) != std::ldexp(1.0, 200) + std::ldexp(1.0, 148) ||
+            conv(p200 + 3 * (cpp_int(1) << 147)) != std::ldexp(1.0, 200) + std::ldexp(1.0, 149) ||
+            conv(p200 + (cpp_int(1) << 147) - 1) != std::ldexp(1.0, 200))
+          return false;
+        if (conv((cpp_int(1) << 256) - 1) != std::ldexp(1.0, 256) || conv(0) != 0.0 ||
+            conv(cpp_int("18446744073709551615")) != 18446744073709551616.0)
+          return false;
+        // 53-bit mantissas at every shift are exact
+        uint64_t m = 0x1f3a5c7e9b2d4ull;
+        for (int k = 0; k + 53 <= 256; k += 5, m = (m * 2862933555777941757ull + 3037000493ull) >> 11 | (1ull << 52))
+          if (conv(cpp_int(m) << k) != std::ldexp(double(m), k)) return false;
+        abi::u256 neg_one, min;
+        neg_one.limbs.fill(~0ull);
+        min.limbs[3] = 1ull << 63;
+        return abi::i256_to_double(neg_one) == -1.0 && abi::i256_to_double(min) == -std::ldexp(1.0, 255);
+      })());
+
+    RUN_TEST("u256_from_decimal rejects bad digits, empty input and overflow",
+      ([&](){
+        abi::Error err;
+        abi::u256 v;
+        std::string digits(40, '7');
+        for (size_t pos : {0, 5, 7, 8, 15, 19, 25, 39}) {
+          for (char c : {'/', ':', 'a', ' ', '-', '\xb5'}) {
+            std::string t = digits;
+            t[pos] = c;
+            if (abi::u256_from_decimal(t, v, &err) || err.message != "decimal: invalid character" ||
+                err.offset != pos)
+              return false;
+          }
+        }
+        if (abi::u256_from_decimal("", v, &err) || err.message != "decimal: empty") return false;
+        const cpp_int max = (cpp_int(1) << 256) - 1;
+        return abi::u256_from_decimal(max.str(), v) && (v.limbs[0] & v.limbs[1] & v.limbs[2] & v.limbs[3]) == ~0ULL &&
+               !abi::u256_from_decimal(cpp_int(max + 1).str(), v, &err) && err.message == "decimal: overflow" &&
+               !abi::u256_from_decimal(std::string(79, '1'), v, &err) && err.message == "decimal: overflow";
+      })());
+  }
+
+  std::cout << "\n== Structured errors ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    namespace P = abi::protocols;
+    using Entries = abi::dyn_array<abi::tuple<abi::uint_t<256>, abi::string_t>>;
+    auto make_entries = [](){
+      std::vector<std::tuple<cpp_int, std::string>> v;
+      for (int i = 0; i < 4; ++i) v.emplace_back(cpp_int(i), std::string(i + 1, 'x'));
+      std::vector<uint8_t> buf(abi::encoded_size<Entries>(v));
+      abi::encode_into<Entries>(buf.data(), buf.size(), v);
+      return buf;
+    };
+    auto word_at = [](const std::vector<uint8_t>& b, size_t pos) {
+      size_t w = 0;
+      abi::read_size_word(b.data() + pos, w);
+      return w;
+    };
+
+    RUN_TEST("nested decode failure reports code, path and absolute offset",
+      ([&](){
+        auto buf = make_entries();
+        // top offset -> array -> element 2 -> its string offset -> length word
+        const size_t arr = word_at(buf, 0);
+        const size_t elem = arr + 32 + word_at(buf, arr + 32 + 2 * 32);
+        const size_t len_pos = elem + word_at(buf, elem + 32);
+        abi::write_u256_imm(buf.data() + len_pos, 1000);
+        abi::value_of<Entries>::type out;
+        abi::Error err;
+        if (abi::decode_from<Entries>(abi::BytesSpan(buf.data(), buf.size()), out, &err)) return false;
+        return err.code == abi::ErrorCode::out_of_range && err.message == "string: len out of range" &&
+               err.path.size() == 2 && err.path[0] == 2 && err.path[1] == 1 && err.offset == len_pos &&
+               err.to_string() == "string: len out of range (path 2.1, offset " + std::to_string(len_pos) + ")";
+      })());
+
+    RUN_TEST("visit and to_json_view report the same path and offset as decode_from",
+      ([&](){
+        auto buf = make_entries();
+        const size_t arr = word_at(buf, 0);
+        const size_t elem = arr + 32 + word_at(buf, arr + 32 + 2 * 32);
+        const size_t len_pos = elem + word_at(buf, elem + 32);
+        abi::write_u256_imm(buf.data() + len_pos, 1000);
+        const abi::BytesSpan in(buf.data(), buf.size());
+        auto same = [&](const abi::Error& err, abi::ErrorCode code, size_t offset, size_t depth) {
+          return err.code == code && err.offset == offset && err.path.size() == depth && err.path[0] == 2 &&
+                 (depth < 2 || err.path[1] == 1);
+        };
+        abi::Visitor vis;
+        char out[1024];
+        abi::BufferSink sink(out, sizeof(out));
+        abi::Error ev, ej;
+        if (abi::visit<Entries>(in, vis, &ev) || abi::to_json_view<Entries>(in, sink, {}, &ej) ||
+            !same(ev, abi::ErrorCode::out_of_range, len_pos, 2) || !same(ej, abi::ErrorCode::out_of_range, len_pos, 2))
+          return false;
+        // element 2's string offset points past the input
+        buf = make_entries();
+        abi::write_u256_imm(buf.data() + elem + 32, 1 << 20);
+        const abi::BytesSpan in2(buf.data(), buf.size());
+        abi::BufferSink sink2(out, sizeof(out));
+        return !abi::visit<Entries>(in2, vis, &ev) && !abi::to_json_view<Entries>(in2, sink2, {}, &ej) &&
+               same(ev, abi::ErrorCode::bad_offset, elem + 32, 1) && same(ej, abi::ErrorCode::bad_offset, elem + 32, 1);
+      })());
+
+    RUN_TEST("container failures point at the offending word and reset the path",
+      ([&](){
+        auto buf = make_entries();
+        const size_t arr = word_at(buf, 0);
+        // element 0 now starts after element 1
+        abi::write_u256_imm(buf.data() + arr + 32, word_at(buf, arr + 32 + 2 * 32));
+        abi::value_of<Entries>::type out;
+        abi::Error err;
+        err.path.push_outer(7);
+        if (abi::decode_from<Entries>(abi::BytesSpan(buf.data(), buf.size()), out, &err)) return false;
+        if (err.code != abi::ErrorCode::bad_offset || err.message != "dyn_array: off order" ||
+            err.offset != arr + 32 || err.path.size() != 0)
+          return false;
+        cpp_int v;
+        return !abi::decode_from<abi::uint_t<256>>(abi::BytesSpan(buf.data(), 8), v, &err) &&
+               err.code == abi::ErrorCode::short_input && err.offset == 0 &&
+               std::string(abi::error_code_name(err.code)) == "short_input" &&
+               err.to_string() == "uintN: short (offset 0)";
+      })());
+
+    RUN_TEST("decode_call paths start at the argument index and count the selector",
+      ([&](){
+        using Swap = P::UniswapV2Router_SwapExactTokensForTokens;
+        std::vector<std::array<uint8_t, 20>> path(3);
+        std::array<uint8_t, 20> to{};
+        const cpp_int amt = 1, deadline = 2;
+        std::vector<uint8_t> cd(Swap::encoded_size(amt, amt, path, to, deadline));
+        Swap::encode_call<cpp_int, cpp_int, std::vector<std::array<uint8_t, 20>>, std::array<uint8_t, 20>,
+                          cpp_int>(cd.data(), cd.size(), amt, amt, path, to, deadline);
+        const size_t len_pos = 4 + word_at(cd, 4 + 2 * 32);
+        abi::write_u256_imm(cd.data() + len_pos, 1000);
+        Swap::args_t args;
+        abi::Error err;
+        if (Swap::decode_call(abi::BytesSpan(cd.data(), cd.size()), args, &err)) return false;
+        return err.code == abi::ErrorCode::short_input && err.message == "dyn_array: inline short" &&
+               err.path.size() == 1 && err.path[0] == 2 && err.offset == len_pos;
+      })());
+
+    RUN_TEST("ResultsView failures carry the entry index",
+      ([&](){
+        std::vector<P::Multicall3_Result> results(3);
+        for (auto& r : results) r.returnData.assign(32, 0x11);
+        using Results = abi::dyn_array<P::Multicall3_Result>;
+        std::vector<uint8_t> buf(abi::encoded_size<Results>(results));
+        abi::encode_into<Results>(buf.data(), buf.size(), results);
+        const size_t elem = 64 + word_at(buf, 64 + 32);
+        const size_t len_pos = elem + word_at(buf, elem + 32);
+        abi::write_u256_imm(buf.data() + len_pos, 0x10000);
+        abi::multicall::ResultsView view;
+        abi::Error err;
+        return !abi::multicall::ResultsView::parse(abi::BytesSpan(buf.data(), buf.size()), view, &err) &&
+               err.code == abi::ErrorCode::out_of_range && err.path.size() == 1 && err.path[0] == 1 &&
+               err.offset == len_pos;
+      })());
+
+    RUN_TEST("deep paths keep the innermost levels",
+      ([&](){
+        abi::Error err;
+        err.set(abi::ErrorCode::short_input, "x: short");
+        for (uint32_t i = 0; i < 10; ++i) err.nest(i, 32);
+        abi::Error copy = err;
+        return copy.path.size() == abi::ErrorPath::max_depth && copy.path.truncated && copy.path[0] == 7 &&
+               copy.path[7] == 0 && copy.offset == 320 &&
+               copy.to_string() == "x: short (path ...7.6.5.4.3.2.1.0, offset 320)";
+      })());
+
+    RUN_TEST("messages from runtime buffers are copied",
+      ([&](){
+        abi::Error err, err2;
+        {
+          std::string s = "runtime text";
+          err.message = s.c_str();
+          err2.set(abi::ErrorCode::other, s.c_str());
+          s.assign(s.size(), '?');
+        }
+        char buf[] = "buffer text";
+        abi::Error err3;
+        err3.set(abi::ErrorCode::other, buf);
+        buf[0] = '?';
+        return err.message == "runtime text" && err2.message == "runtime text" &&
+               err3.message == "buffer text";
+      })());
+  }
+
+  std::cout << "\n== Decode limits ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    using Words = abi::dyn_array<abi::uint_t<256>>;
+    auto encode_words = [](size_t n) {
+      std::vector<cpp_int> v(n, cpp_int(7));
+      std::vector<uint8_t> buf(abi::encoded_size<Words>(v));
+      abi::encode_into<Words>(buf.data(), buf.size(), v);
+      return buf;
+    };
+
+    RUN_TEST("hostile lengths fail before allocating",
+      ([&](){
+        auto buf = encode_words(2);
+        abi::write_u256_imm(buf.data() + 32, uint64_t(1) << 40);
+        std::vector<cpp_int> out;
+        abi::Error err;
+        if (abi::decode_from<Words>(abi::BytesSpan(buf.data(), buf.size()), out, &err) ||
+            err.code != abi::ErrorCode::short_input || out.capacity() != 0)
+          return false;
+        // dynamic elements: 2^32 offsets claimed in a few hundred bytes
+        using Blobs = abi::dyn_array<abi::bytes>;
+        std::vector<std::vector<uint8_t>> blobs(2, std::vector<uint8_t>(40, 1)), blobs_out;
+        std::vector<uint8_t> b2(abi::encoded_size<Blobs>(blobs));
+        abi::encode_into<Blobs>(b2.data(), b2.size(), blobs);
+        abi::write_u256_imm(b2.data() + 32, uint64_t(1) << 32);
+        if (abi::decode_from<Blobs>(abi::BytesSpan(b2.data(), b2.size()), blobs_out, &err) ||
+            blobs_out.capacity() != 0)
+          return false;
+        // a bytes length of 2^64 - 1 must not wrap the bounds check
+        std::vector<uint8_t> b3(96, 0);
+        b3[31] = 32;
+        std::memset(b3.data() + 56, 0xff, 8);
+        std::vector<uint8_t> bytes_out;
+        return !abi::decode_from<abi::bytes>(abi::BytesSpan(b3.data(), b3.size()), bytes_out, &err) &&
+               err.message == "bytes: len out of range" && bytes_out.capacity() == 0;
+      })());
+
+    RUN_TEST("DecodeLimits caps bytes, elements and depth",
+      ([&](){
+        abi::Error err;
+        std::vector<uint8_t> blob(1000, 0xab), blob_out;
+        std::vector<uint8_t> b1(abi::encoded_size<abi::bytes>(blob));
+        abi::encode_into<abi::bytes>(b1.data(), b1.size(), blob);
+        abi::DecodeLimits lim;
+        lim.max_bytes = 999;
+        if (abi::decode_from<abi::bytes>(abi::BytesSpan(b1.data(), b1.size()), blob_out, lim, &err) ||
+            err.code != abi::ErrorCode::limit_exceeded || !blob_out.empty())
+          return false;
+        lim.max_bytes = 1000;
+        if (!abi::decode_from<abi::bytes>(abi::BytesSpan(b1.data(), b1.size()), blob_out, lim, &err) ||
+            blob_out != blob)
+          return false;
+
+        auto b2 = encode_words(10);
+        std::vector<cpp_int> words;
+        abi::DecodeLimits few;
+        few.max_elements = 9;
+        if (abi::decode_from<Words>(abi::BytesSpan(b2.data(), b2.size()), words, few, &err) ||
+            err.message != "limits: too many elements")
+          return false;
+        few.max_elements = 10;
+        if (!abi::decode_from<Words>(abi::BytesSpan(b2.data(), b2.size()), words, few) || words.size() != 10)
+          return false;
+
+        using Nested = abi::dyn_array<Words>;
+        std::vector<std::vector<cpp_int>> nested{{1, 2}, {3}}, nested_out;
+        std::vector<uint8_t> b3(abi::encoded_size<Nested>(nested));
+        abi::encode_into<Nested>(b3.data(), b3.size(), nested);
+        abi::DecodeLimits shallow;
+        shallow.max_depth = 1;
+        if (abi::decode_from<Nested>(abi::BytesSpan(b3.data(), b3.size()), nested_out, shallow, &err) ||
+            err.message != "limits: too deep" || err.path.size() != 1 || err.path[0] != 0)
+          return false;
+        shallow.max_depth = 2;
+        return abi::decode_from<Nested>(abi::BytesSpan(b3.data(), b3.size()), nested_out, shallow) &&
+               nested_out == nested && abi::detail::decode_budget == nullptr;
+      })());
+
+    RUN_TEST("ResultRef::decode under limits",
+      ([&](){
+        std::vector<abi::protocols::Multicall3_Result> results(2);
+        results[0].success = true;
+        results[0].returnData = encode_words(50);
+        results[1].success = true;
+        results[1].returnData = encode_words(3);
+        using Results = abi::dyn_array<abi::protocols::Multicall3_Result>;
+        std::vector<uint8_t> buf(abi::encoded_size<Results>(results));
+        abi::encode_into<Results>(buf.data(), buf.size(), results);
+        abi::multicall::ResultsView view;
+        if (!abi::multicall::ResultsView::parse(abi::BytesSpan(buf.data(), buf.size()), view)) return false;
+        using F = abi::Fn<struct NoSel, Words>;
+        abi::DecodeLimits lim;
+        lim.max_elements = 8;
+        F::return_t out;
+        abi::Error err;
+        return !view[0].decode<F>(out, lim, &err) && err.code == abi::ErrorCode::limit_exceeded &&
+               view[1].decode<F>(out, lim) && out.size() == 3;
+      })());
+  }
+
+  std::cout << "\n== Trusted decode policy ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    namespace P = abi::protocols;
+
+    RUN_TEST("trusted decode matches checked on nested dynamic schemas",
+      ([&](){
+        using S = abi::tuple<abi::uint_t<64>, abi::dyn_array<abi::tuple<abi::address20, abi::bytes>>,
+                             abi::static_array<abi::string_t, 2>, abi::int_t<24>, abi::static_array<abi::bool_t, 3>>;
+        abi::value_of<S>::type v;
+        std::get<0>(v) = 42;
+        for (int i = 0; i < 3; ++i) {
+          std::array<uint8_t, 20> a;
+          a.fill(static_cast<uint8_t>(i));
+          std::get<1>(v).emplace_back(a, std::vector<uint8_t>(static_cast<size_t>(i * 17), 0xcd));
+        }
+        std::get<2>(v) = {std::string("alpha"), std::string(40, 'z')};
+        std::get<3>(v) = -5;
+        std::get<4>(v) = {true, false, true};
+        std::vector<uint8_t> buf(abi::encoded_size<S>(v));
+        abi::encode_into<S>(buf.data(), buf.size(), v);
+        abi::value_of<S>::type a, b;
+        const abi::BytesSpan in(buf.data(), buf.size());
+        return abi::decode_from<S>(in, a) && abi::decode_from<S, abi::trusted>(in, b) && a == v && b == v;
+      })());
+
+    RUN_TEST("trusted Fn::decode_result and decode_call",
+      ([&](){
+        std::vector<P::Multicall3_Result> results(5);
+        for (size_t i = 0; i < results.size(); ++i) {
+          results[i].success = i % 2;
+          results[i].returnData.assign(i * 13, static_cast<uint8_t>(i));
+        }
+        using Agg = P::Multicall_Aggregate3;
+        using Results = abi::dyn_array<P::Multicall3_Result>;
+        std::vector<uint8_t> buf(abi::encoded_size<Results>(results));
+        abi::encode_into<Results>(buf.data(), buf.size(), results);
+        Agg::return_t out;
+        if (!Agg::decode_result<abi::trusted>(abi::BytesSpan(buf.data(), buf.size()), out) ||
+            out.size() != results.size())
+          return false;
+        for (size_t i = 0; i < out.size(); ++i)
+          if (out[i].success != results[i].success || out[i].returnData != results[i].returnData) return false;
+
+        using Swap = P::UniswapV2Router_SwapExactTokensForTokens;
+        std::vector<std::array<uint8_t, 20>> path(2);
+        path[1].fill(0x42);
+        std::array<uint8_t, 20> to{};
+        const cpp_int amt = 10, deadline = 99;
+        std::vector<uint8_t> cd(Swap::encoded_size(amt, amt, path, to, deadline));
+        Swap::encode_call<cpp_int, cpp_int, std::vector<std::array<uint8_t, 20>>, std::array<uint8_t, 20>,
+                          cpp_int>(cd.data(), cd.size(), amt, amt, path, to, deadline);
+        Swap::args_t args;
+        if (!Swap::decode_call<abi::trusted>(abi::BytesSpan(cd.data(), cd.size()), args) ||
+            std::get<2>(args) != path || std::get<4>(args) != deadline)
+          return false;
+        cd[0] ^= 0xff;  // calldata for some other function
+        abi::Error err;
+        return !Swap::decode_call<abi::trusted>(abi::BytesSpan(cd.data(), cd.size()), args, &err) &&
+               err.code == abi::ErrorCode::selector_mismatch;
+      })());
+  }
+
+  std::cout << "\n== Canonical encoding ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    namespace P = abi::protocols;
+    using S = abi::tuple<abi::uint_t<64>, abi::dyn_array<abi::tuple<abi::address20, abi::bytes>>,
+                         abi::static_array<abi::string_t, 2>, abi::int_t<24>, abi::static_array<abi::bool_t, 3>>;
+    auto encode_s = [] {
+      abi::value_of<S>::type v;
+      std::get<0>(v) = 42;
+      for (int i = 0; i < 3; ++i) {
+        std::array<uint8_t, 20> a;
+        a.fill(static_cast<uint8_t>(0x80 + i));
+        std::get<1>(v).emplace_back(a, std::vector<uint8_t>(static_cast<size_t>(i * 17), 0xcd));
+      }
+      std::get<2>(v) = {std::string("alpha"), std::string(40, 'z')};
+      std::get<3>(v) = -5;
+      std::get<4>(v) = {true, false, true};
+      std::vector<uint8_t> buf(abi::encoded_size<S>(v));
+      abi::encode_into<S>(buf.data(), buf.size(), v);
+      return buf;
+    };
+    using Results = abi::dyn_array<P::Multicall3_Result>;
+    auto encode_results = [](std::vector<size_t> sizes) {
+      std::vector<P::Multicall3_Result> results(sizes.size());
+      for (size_t i = 0; i < sizes.size(); ++i) {
+        results[i].success = true;
+        results[i].returnData.assign(sizes[i], 0xab);
+      }
+      std::vector<uint8_t> buf(abi::encoded_size<Results>(results));
+      abi::encode_into<Results>(buf.data(), buf.size(), results);
+      return buf;
+    };
+    auto span = [](const std::vector<uint8_t>& b) { return abi::BytesSpan(b.data(), b.size()); };
+
+    RUN_TEST("encoder output is canonical",
+      ([&](){
+        using Swap = P::UniswapV2Router_SwapExactTokensForTokens;
+        std::vector<std::array<uint8_t, 20>> path(2);
+        path[1].fill(0xff);
+        std::array<uint8_t, 20> to{};
+        const cpp_int amt = 10, deadline = 99;
+        std::vector<uint8_t> cd(Swap::encoded_size(amt, amt, path, to, deadline));
+        Swap::encode_call<cpp_int, cpp_int, std::vector<std::array<uint8_t, 20>>, std::array<uint8_t, 20>,
+                          cpp_int>(cd.data(), cd.size(), amt, amt, path, to, deadline);
+        const abi::BytesSpan args(cd.data() + 4, cd.size() - 4);
+        abi::Error err;
+        return abi::validate_canonical<S>(span(encode_s()), &err) &&
+               abi::validate_canonical<Results>(span(encode_results({0, 13, 32, 64}))) &&
+               abi::validate_canonical<Results>(span(encode_results({}))) &&
+               abi::validate_canonical_call<Swap>(span(cd)) &&
+               abi::validate_canonical_args<abi::uint_t<256>, abi::uint_t<256>, abi::dyn_array<abi::address20>,
+                                            abi::address20, abi::uint_t<256>>(args) &&
+               !abi::validate_canonical_call<P::Multicall_Aggregate3>(span(cd), &err) &&
+               err.code == abi::ErrorCode::selector_mismatch;
+      })());
+
+    RUN_TEST("dirty words are rejected where decode accepts them",
+      ([&](){
+        // Expect decode_from to succeed and validate_canonical to fail at off
+        auto rejects = [&](const std::vector<uint8_t>& b, size_t off, const char* msg) {
+          abi::value_of<S>::type out;
+          abi::Error err;
+          if (!abi::decode_from<S>(span(b), out) || abi::validate_canonical<S>(span(b), &err)) return false;
+          if (err.code != abi::ErrorCode::non_canonical || err.offset != off || err.message != msg) {
+            std::cerr << "got: " << err.to_string() << "\n";
+            return false;
+          }
+          return true;
+        };
+        const std::vector<uint8_t> good = encode_s();
+        // top pointer, then the tuple head: uint64 at 32, int24 at 128, bools from 160
+        auto b = good;
+        b[32] = 1;
+        if (!rejects(b, 32, "uintN: out of range")) return false;
+        b = good;
+        b[128] = 0x00;
+        if (!rejects(b, 128, "intN: bad sign extension")) return false;
+        b = good;
+        b[160 + 32 + 31] = 2;
+        if (!rejects(b, 192, "bool: not 0 or 1")) return false;
+        b = good;
+        b.push_back(0);
+        if (!rejects(b, good.size(), "canonical: trailing bytes")) return false;
+
+        // bytes padding: [32][len 5][data + padding]
+        std::vector<uint8_t> raw(96, 0);
+        abi::encode_into<abi::bytes>(raw.data(), raw.size(), std::vector<uint8_t>(5, 0x11));
+        raw[64 + 7] = 1;
+        abi::Error err;
+        if (abi::validate_canonical<abi::bytes>(span(raw), &err) || err.offset != 69 ||
+            err.message != "bytes: dirty padding")
+          return false;
+        // address high bytes in a static tuple
+        std::vector<uint8_t> st(64, 0);
+        st[11] = 1;
+        return !abi::validate_canonical<abi::tuple<abi::address20, abi::uint_t<256>>>(span(st), &err) &&
+               err.message == "address: dirty high bytes" && err.offset == 0;
+      })());
+
+    RUN_TEST("non-canonical offsets are rejected with their path",
+      ([&](){
+        // Shared tail: (bytes, bytes) with both offsets pointing at one payload
+        using Pair = abi::tuple<abi::bytes, abi::bytes>;
+        abi::value_of<Pair>::type v{std::vector<uint8_t>{1, 2}, std::vector<uint8_t>{1, 2}};
+        std::vector<uint8_t> b(abi::encoded_size<Pair>(v));
+        abi::encode_into<Pair>(b.data(), b.size(), v);
+        abi::write_u256_imm(b.data() + 64, 64);
+        b.resize(160);
+        abi::value_of<Pair>::type out;
+        abi::Error err;
+        if (!abi::decode_from<Pair>(span(b), out) || out != v) return false;
+        if (abi::validate_canonical<Pair>(span(b), &err) || err.code != abi::ErrorCode::non_canonical ||
+            err.offset != 64)
+          return false;
+
+        // Top pointer past a gap
+        std::vector<uint8_t> gap(128, 0);
+        abi::write_u256_imm(gap.data(), 64);
+        abi::write_u256_imm(gap.data() + 64, 1);
+        gap[96] = 0x33;
+        std::vector<uint8_t> bytes_out;
+        if (!abi::decode_from<abi::bytes>(span(gap), bytes_out) || abi::validate_canonical<abi::bytes>(span(gap), &err) ||
+            err.message != "top: non-canonical offset")
+          return false;
+
+        // Dirty bool in element 1 of aggregate3 results: [ptr][len][2 offs][elem 0: 3 words][elem 1 at 224]
+        auto r = encode_results({0, 13});
+        r[224 + 31] = 7;
+        return !abi::validate_canonical<Results>(span(r), &err) && err.offset == 224 && err.path.size() == 2 &&
+               err.path[0] == 1 && err.path[1] == 0 && err.message == "bool: not 0 or 1";
+      })());
+  }
+
+  std::cout << "\n== Decode into existing storage ==\n";
+  {
+    using boost::multiprecision::cpp_int;
+    namespace P = abi::protocols;
+    using Agg = P::Multicall_Aggregate3;
+    using Results = abi::dyn_array<P::Multicall3_Result>;
+    auto encode_results = [](size_t n, size_t len, uint8_t fill) {
+      std::vector<P::Multicall3_Result> results(n);
+      for (size_t i = 0; i < n; ++i) {
+        results[i].success = (i + fill) % 2;
+        results[i].returnData.assign(len, static_cast<uint8_t>(fill + i));
+      }
+      std::vector<uint8_t> buf(abi::encoded_size<Results>(results));
+      abi::encode_into<Results>(buf.data(), buf.size(), results);
+      return std::make_pair(results, buf);
+    };
+
+    RUN_TEST("decode_result refills returnData buffers in place",
+      ([&](){
+        Agg::return_t out;
+        auto [r1, b1] = encode_results(8, 96, 1);
+        if (!Agg::decode_result(abi::BytesSpan(b1.data(), b1.size()), out)) return false;
+        std::vector<const uint8_t*> ptrs;
+        for (const auto& r : out) ptrs.push_back(r.returnData.data());
+        // Next block: fewer, shorter results
+        auto [r2, b2] = encode_results(6, 40, 7);
+        if (!Agg::decode_result(abi::BytesSpan(b2.data(), b2.size()), out) || out.size() != 6) return false;
+        for (size_t i = 0; i < out.size(); ++i) {
+          if (out[i].returnData.data() != ptrs[i] || out[i].returnData.capacity() < 96) return false;
+          if (out[i].returnData != r2[i].returnData || out[i].success != r2[i].success) return false;
+        }
+        return true;
+      })());
+
+    RUN_TEST("integers decode into their existing limbs",
+      ([&](){
+        std::vector<uint8_t> w(32);
+        cpp_int x;
+        const cpp_int big = (cpp_int(1) << 255) + 12345;
+        abi::write_u256_big(w.data(), big);
+        if (!abi::decode_from<abi::uint_t<256>>(abi::BytesSpan(w.data(), 32), x) || x != big) return false;
+        const auto* limbs = x.backend().limbs();
+        abi::write_u256_big(w.data(), big - 1);
+        if (!abi::decode_from<abi::uint_t<256>>(abi::BytesSpan(w.data(), 32), x) || x != big - 1 ||
+            x.backend().limbs() != limbs)
+          return false;
+        // intN matches sign_extend on canonical and dirty words
+        for (int k = 0; k < 64; ++k) {
+          for (int i = 0; i < 32; ++i) w[i] = static_cast<uint8_t>((k * 131 + i * 29) ^ (i * k));
+          cpp_int a, b, c, d;
+          abi::read_int_big<24>(w.data(), a);
+          abi::read_int_big<128>(w.data(), b);
+          abi::read_int_big<256>(w.data(), c);
+          abi::read_int_big<8>(w.data(), d);
+          const cpp_int raw = abi::read_u256_big(w.data());
+          if (a != abi::sign_extend<24>(raw) || b != abi::sign_extend<128>(raw) || c != abi::sign_extend<256>(raw) ||
+              d != abi::sign_extend<8>(raw))
+            return false;
+        }
+        return true;
+      })());
+
+    RUN_TEST("named structs and event data decode through tie()",
+      ([&](){
+        std::vector<P::ITickLens_PopulatedTick> ticks(4), out;
+        for (int i = 0; i < 4; ++i) {
+          ticks[i].tick = -887220 + i;
+          ticks[i].liquidityNet = -(cpp_int(1) << 60) * (i + 1);
+          ticks[i].liquidityGross = (cpp_int(1) << 127) + i;
+        }
+        using Ticks = abi::dyn_array<P::ITickLens_PopulatedTick>;
+        std::vector<uint8_t> buf(abi::encoded_size<Ticks>(ticks));
+        abi::encode_into<Ticks>(buf.data(), buf.size(), ticks);
+        if (!abi::decode_from<Ticks>(abi::BytesSpan(buf.data(), buf.size()), out) || out.size() != 4) return false;
+        for (int i = 0; i < 4; ++i)
+          if (out[i].tick != ticks[i].tick || out[i].liquidityNet != ticks[i].liquidityNet ||
+              out[i].liquidityGross != ticks[i].liquidityGross)
+            return false;
+        using Transfer = P::ERC20_TransferEvent;
+        std::vector<uint8_t> data(Transfer::encoded_data_size(cpp_int(77)));
+        Transfer::encode_data<cpp_int>(data.data(), data.size(), cpp_int(77));
+        P::ERC20_TransferEventData ev;
+        return Transfer::decode_data(abi::BytesSpan(data.data(), data.size()), ev) && ev.value == 77;
+      })());
+  }
+
+  std::cout << "\n== pmr containers ==\n";
+  {
+    namespace P = abi::protocols;
+    // Counts what reaches the upstream resource
+    struct CountingResource : std::pmr::memory_resource {
+      size_t allocs = 0;
+      void* do_allocate(size_t n, size_t align) override {
+        ++allocs;
+        return std::pmr::new_delete_resource()->allocate(n, align);
+      }
+      void do_deallocate(void* p, size_t n, size_t align) override {
+        std::pmr::new_delete_resource()->deallocate(p, n, align);
+      }
+      bool do_is_equal(const std::pmr::memory_resource& o) const noexcept override { return this == &o; }
+    };
+    using Results = abi::dyn_array<abi::tuple<abi::bool_t, abi::bytes>>;
+    abi::value_of<Results>::type results;
+    for (size_t i = 0; i < 16; ++i) results.emplace_back(i % 2, std::vector<uint8_t>(40 + i, static_cast<uint8_t>(i)));
+    std::vector<uint8_t> buf(abi::encoded_size<Results>(results));
+    abi::encode_into<Results>(buf.data(), buf.size(), results);
+    const abi::BytesSpan in(buf.data(), buf.size());
+
+    RUN_TEST("decode tree allocates from the caller's resource",
+      ([&](){
+        CountingResource counting;
+        std::pmr::monotonic_buffer_resource arena(&counting);
+        abi::pmr_value_t<Results> out(&arena);
+        if (!abi::decode_from<Results>(in, out) || out.size() != results.size()) return false;
+        for (size_t i = 0; i < out.size(); ++i) {
+          const auto& data = std::get<1>(out[i]);
+          if (data.get_allocator().resource() != &arena || std::get<0>(out[i]) != std::get<0>(results[i]) ||
+              !std::equal(data.begin(), data.end(), std::get<1>(results[i]).begin(), std::get<1>(results[i]).end()))
+            return false;
+        }
+        // 17 vectors served by a handful of arena chunks
+        return counting.allocs > 0 && counting.allocs < 8;
+      })());
+
+    RUN_TEST("pmr values encode like std values",
+      ([&](){
+        std::pmr::monotonic_buffer_resource arena;
+        using S = abi::tuple<abi::string_t, abi::dyn_array<abi::string_t>, abi::bytes>;
+        abi::pmr_value_t<S> v(std::allocator_arg, std::pmr::polymorphic_allocator<char>(&arena));
+        std::get<0>(v) = "pmr";
+        std::get<1>(v).emplace_back("a");
+        std::get<1>(v).emplace_back(std::string(40, 'b'));
+        std::get<2>(v).assign(33, 0x5a);
+        abi::value_of<S>::type w{"pmr", {"a", std::string(40, 'b')}, std::vector<uint8_t>(33, 0x5a)};
+        std::vector<uint8_t> a(abi::encoded_size<S>(v)), b(abi::encoded_size<S>(w));
+        abi::encode_into<S>(a.data(), a.size(), v);
+        abi::encode_into<S>(b.data(), b.size(), w);
+        abi::pmr_value_t<S> back(std::allocator_arg, std::pmr::polymorphic_allocator<char>(&arena));
+        return a == b && abi::decode_from<S>(abi::BytesSpan(a.data(), a.size()), back) && back == v &&
+               std::get<1>(back)[1].get_allocator().resource() == &arena;
+      })());
+
+    RUN_TEST("named structs inside pmr arrays",
+      ([&](){
+        std::vector<P::Multicall3_Result> rs(3);
+        for (size_t i = 0; i < rs.size(); ++i) rs[i].returnData.assign(i * 20, 1);
+        using R = abi::dyn_array<P::Multicall3_Result>;
+        std::vector<uint8_t> b(abi::encoded_size<R>(rs));
+        abi::encode_into<R>(b.data(), b.size(), rs);
+        std::pmr::monotonic_buffer_resource arena;
+        abi::pmr_value_t<R> out(&arena);
+        static_assert(std::is_same_v<abi::pmr_value_t<R>::value_type, P::pmr::Multicall3_Result>);
+        return abi::decode_from<R>(abi::BytesSpan(b.data(), b.size()), out) && out.size() == 3 &&
+               std::equal(out[2].returnData.begin(), out[2].returnData.end(), rs[2].returnData.begin(),
+                          rs[2].returnData.end()) &&
+               out[2].returnData.get_allocator().resource() == &arena;
+      })());
+
+    RUN_TEST("generated results decode into the arena",
+      ([&](){
+        using Agg = P::Multicall_Aggregate3;
+        Agg::return_t rs(16);
+        for (size_t i = 0; i < rs.size(); ++i) {
+          rs[i].success = i % 3 != 0;
+          rs[i].returnData.assign(40 + i, static_cast<uint8_t>(i));
+        }
+        using R = Agg::return_schema;
+        std::vector<uint8_t> b(abi::encoded_size<R>(rs));
+        abi::encode_into<R>(b.data(), b.size(), rs);
+        CountingResource counting;
+        std::pmr::monotonic_buffer_resource arena(&counting);
+        Agg::pmr_return_t out(&arena);
+        if (!Agg::decode_result(abi::BytesSpan(b.data(), b.size()), out) || out.size() != rs.size()) return false;
+        for (size_t i = 0; i < out.size(); ++i) {
+          if (out[i].success != rs[i].success || out[i].returnData.get_allocator().resource() != &arena ||
+              !std::equal(out[i].returnData.begin(), out[i].returnData.end(), rs[i].returnData.begin(),
+                          rs[i].returnData.end()))
+            return false;
+        }
+        // A copy into another pmr container moves to that container's resource
+        std::pmr::monotonic_buffer_resource other;
+        std::pmr::vector<P::pmr::Multicall3_Result> copy(out.begin(), out.end(), &other);
+        std::vector<uint8_t> back(abi::encoded_size<R>(copy));
+        abi::encode_into<R>(back.data(), back.size(), copy);
+        // 17 vectors served by a handful of arena chunks
+        return counting.allocs > 0 && counting.allocs < 8 && back == b &&
+               copy[5].returnData.get_allocator().resource() == &other;
+      })());
+  }
   
   std::cout << "\nSummary: " << counts.passed << " / " << counts.total << " passed\n";
   return (counts.passed == counts.total) ? 0 : 1;